@@ -0,0 +1,470 @@
+#include "TsuCodeGenerator.h"
+
+#include "TsuGeneratorLog.h"
+#include "UObject/UnrealType.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+// Can't use FRegexMatcher in UHT plugins
+#include <regex>
+
+namespace TsuCodeGenerator_Private
+{
+
+// Mirrors the helpers of the same name in TsuUtilities, which this plugin can't depend on since UHT can't load TSU
+
+bool IsFieldDeprecated(const UField* Field)
+{
+	static const FName MetaDeprecatedFunction = TEXT("DeprecatedFunction");
+	static const FName MetaCategory = TEXT("Category");
+	static const FName MetaDisplayName = TEXT("DisplayName");
+
+	if (Field->HasMetaData(MetaDeprecatedFunction))
+		return true;
+
+	if (Field->GetMetaData(MetaCategory) == TEXT("Deprecated"))
+		return true;
+
+	if (Field->HasMetaData(MetaDisplayName))
+	{
+		const FString& DisplayName = Field->GetMetaData(MetaDisplayName);
+		if (DisplayName.Contains(TEXT("deprecated"), ESearchCase::IgnoreCase))
+			return true;
+	}
+
+	return false;
+}
+
+template<typename T>
+TFieldRange<T> TImmediateFieldRange(const UStruct* Struct)
+{
+	return TFieldRange<T>(
+		Struct,
+		EFieldIteratorFlags::ExcludeSuper,
+		EFieldIteratorFlags::ExcludeDeprecated,
+		EFieldIteratorFlags::ExcludeInterfaces);
+}
+
+void AppendToolTip(FString& Result, UField* Field)
+{
+	if (!Field->HasMetaData(TEXT("ToolTip")))
+		return;
+
+	static const std::wregex NewlinePattern(L"\\r?\\n");
+
+	const FString ToolTip = std::regex_replace(
+		*Field->GetMetaData(TEXT("ToolTip")),
+		NewlinePattern,
+		L"\r\n * "
+	).c_str();
+
+	Result += TEXT("/**\r\n");
+	Result += FString::Printf(TEXT(" * %s\r\n"), *ToolTip);
+	Result += TEXT(" */\r\n");
+}
+
+/** Gets the parameters of a function, including the return value, in the order that they're laid out */
+TArray<UProperty*> GetParameters(UFunction* Function)
+{
+	TArray<UProperty*> Result;
+
+	for (TFieldIterator<UProperty> It(Function); It && (It->PropertyFlags & CPF_Parm); ++It)
+		Result.Add(*It);
+
+	return Result;
+}
+
+} // namespace TsuCodeGenerator_Private
+
+FTsuCodeGenerator::FTsuCodeGenerator(
+	const FString& InRootLocalPath,
+	const FString& InRootBuildPath,
+	const FString& InOutputDirectory,
+	const FString& InIncludeBase)
+	: RootLocalPath(InRootLocalPath)
+	, RootBuildPath(InRootBuildPath)
+	, GeneratedCodePath(InOutputDirectory)
+	, IncludeBase(InIncludeBase)
+{
+}
+
+bool FTsuCodeGenerator::SaveHeaderIfChanged(const FString& HeaderPath, const FString& NewHeaderContents)
+{
+	FString OriginalHeaderLocal;
+	FFileHelper::LoadFileToString(OriginalHeaderLocal, *HeaderPath);
+
+	const bool bHasChanged = OriginalHeaderLocal.Len() == 0 || FCString::Strcmp(*OriginalHeaderLocal, *NewHeaderContents);
+	if (bHasChanged)
+	{
+		// save the updated version to a tmp file so that the user can see what will be changing
+		const FString TmpHeaderFilename = HeaderPath + TEXT(".tmp");
+
+		// delete any existing temp file
+		IFileManager::Get().Delete(*TmpHeaderFilename, false, true);
+		if (!FFileHelper::SaveStringToFile(NewHeaderContents, *TmpHeaderFilename))
+		{
+			UE_LOG(LogTsuGenerator, Warning, TEXT("Failed to save header export: '%s'"), *TmpHeaderFilename);
+		}
+		else
+		{
+			TempHeaders.Add(TmpHeaderFilename);
+		}
+	}
+
+	return bHasChanged;
+}
+
+void FTsuCodeGenerator::RenameTempFiles()
+{
+	for (FString& TempFilename : TempHeaders)
+	{
+		const FString Filename = TempFilename.Replace(TEXT(".tmp"), TEXT(""));
+		if (!IFileManager::Get().Move(*Filename, *TempFilename, true, true))
+		{
+			UE_LOG(LogTsuGenerator, Error, TEXT("%s"), *FString::Printf(TEXT("Couldn't write file '%s'"), *Filename));
+		}
+		else
+		{
+			UE_LOG(LogTsuGenerator, Log, TEXT("Exported updated script header: %s"), *Filename);
+		}
+	}
+}
+
+bool FTsuCodeGenerator::GetIncludePath(const FString& SourceHeaderFilename, FString& OutIncludePath) const
+{
+	const FString Filename = FPaths::ConvertRelativePathToFull(SourceHeaderFilename);
+
+	for (const TCHAR* IncludeDirectory : {TEXT("/Public/"), TEXT("/Classes/")})
+	{
+		const int32 Index = Filename.Find(IncludeDirectory, ESearchCase::IgnoreCase, ESearchDir::FromEnd);
+		if (Index != INDEX_NONE)
+		{
+			OutIncludePath = Filename.Mid(Index + FCString::Strlen(IncludeDirectory));
+			return true;
+		}
+	}
+
+	return false;
+}
+
+FString FTsuCodeGenerator::GetClassNameCPP(UClass* Class) const
+{
+	return FString::Printf(TEXT("%s%s"), Class->GetPrefixCPP(), *Class->GetName());
+}
+
+FString FTsuCodeGenerator::GetScriptHeaderForClass(UClass* Class)
+{
+	return GeneratedCodePath / (Class->GetName() + TEXT(".tsu.h"));
+}
+
+bool FTsuCodeGenerator::CanExportClass(UClass* Class) const
+{
+	using namespace TsuCodeGenerator_Private;
+
+	// Interfaces are only ever called through ProcessEvent
+	if (Class->HasAnyClassFlags(CLASS_Interface | CLASS_Deprecated))
+		return false;
+
+	if (ExportedClasses.Contains(Class->GetFName()))
+		return false;
+
+	for (auto Function : TImmediateFieldRange<UFunction>(Class))
+	{
+		if (CanExportFunction(Class, Function))
+			return true;
+	}
+
+	for (auto Property : TImmediateFieldRange<UProperty>(Class))
+	{
+		if (CanExportProperty(Class, Property))
+			return true;
+	}
+
+	return false;
+}
+
+void FTsuCodeGenerator::ExportClass(UClass* Class, const FString& SourceHeaderFilename, const FString& GeneratedHeaderFilename, bool bHasChanged)
+{
+	using namespace TsuCodeGenerator_Private;
+
+	if (!CanExportClass(Class))
+		return;
+
+	// Classes declared in private headers can't be included from TsuRuntime
+	FString IncludePath;
+	if (!GetIncludePath(SourceHeaderFilename, IncludePath))
+		return;
+
+	UE_LOG(LogTsuGenerator, Log, TEXT("Exporting class %s"), *Class->GetName());
+
+	ExportedClasses.Add(Class->GetFName());
+	AllSourceClassHeaders.AddUnique(IncludePath);
+
+	const FString ClassGlueFilename = GetScriptHeaderForClass(Class);
+	AllScriptHeaders.Add(ClassGlueFilename);
+
+	const FString ClassNameCPP = GetClassNameCPP(Class);
+	FString GeneratedGlue(TEXT("#pragma once\r\n\r\n"));
+	FString Registrations;
+
+	for (auto Function : TImmediateFieldRange<UFunction>(Class))
+	{
+		if (CanExportFunction(Class, Function))
+		{
+			UE_LOG(LogTsuGenerator, Log, TEXT("  %s %s"), *Function->GetClass()->GetName(), *Function->GetName());
+			GeneratedGlue += ExportFunction(ClassNameCPP, Class, Function, Registrations);
+		}
+	}
+
+	for (auto Property : TImmediateFieldRange<UProperty>(Class))
+	{
+		if (CanExportProperty(Class, Property))
+		{
+			UE_LOG(LogTsuGenerator, Log, TEXT("  %s %s"), *Property->GetClass()->GetName(), *Property->GetName());
+			GeneratedGlue += ExportProperty(ClassNameCPP, Class, Property, Registrations);
+		}
+	}
+
+	const FString RegisterFunction = TEXT("TsuRegister_") + ClassNameCPP;
+	AllRegisterFunctions.Add(RegisterFunction);
+
+	GeneratedGlue += FString::Printf(TEXT("static void %s(FTsuStaticBindings& Bindings)\r\n"), *RegisterFunction);
+	GeneratedGlue += TEXT("{\r\n");
+	GeneratedGlue += Registrations;
+	GeneratedGlue += TEXT("}\r\n");
+
+	SaveHeaderIfChanged(ClassGlueFilename, GeneratedGlue);
+}
+
+bool FTsuCodeGenerator::CanExportFunction(UClass* Class, UFunction* Function)
+{
+	using namespace TsuCodeGenerator_Private;
+
+	// Only the functions that scripts can see, and that can be called directly, without going through the VM
+	if (!Function->HasAllFunctionFlags(FUNC_Native | FUNC_Public | FUNC_BlueprintCallable))
+		return false;
+
+	if (Function->HasAnyFunctionFlags(FUNC_Delegate | FUNC_Event | FUNC_Net | FUNC_EditorOnly))
+		return false;
+
+	// Functions aren't exported from their module unless the whole class is
+	if (!Class->HasAnyClassFlags(CLASS_RequiredAPI))
+		return false;
+
+	if (Function->HasMetaData(TEXT("CustomThunk")))
+		return false;
+
+	if (IsFieldDeprecated(Function))
+		return false;
+
+	if (Function->HasMetaData(TEXT("BlueprintGetter")) || Function->HasMetaData(TEXT("BlueprintSetter")))
+		return false;
+
+	if (Function->GetName().StartsWith(TEXT("OnRep_")))
+		return false;
+
+	for (auto It = TFieldIterator<UProperty>(Function); It; ++It)
+	{
+		UProperty* Param = *It;
+		if (Param->IsA<UArrayProperty>() ||
+			Param->IsA<USetProperty>() ||
+			Param->IsA<UMapProperty>() ||
+			Param->ArrayDim > 1 ||
+			Param->IsA<UDelegateProperty>() ||
+			Param->IsA<UMulticastDelegateProperty>() ||
+			Param->IsA<UWeakObjectProperty>() ||
+			Param->IsA<UInterfaceProperty>())
+		{
+			return false;
+		}
+
+		// These are declared as `TEnumAsByte<T>` in the parameter struct, which won't bind to a `T&`
+		auto ByteParam = Cast<UByteProperty>(Param);
+		if (ByteParam && ByteParam->Enum && Param->HasAnyPropertyFlags(CPF_OutParm))
+			return false;
+	}
+
+	return true;
+}
+
+FString FTsuCodeGenerator::ExportFunction(const FString& ClassNameCPP, UClass* Class, UFunction* Function, FString& OutRegistration)
+{
+	using namespace TsuCodeGenerator_Private;
+
+	const FString StubName = ClassNameCPP + TEXT("_") + Function->GetName();
+	const FString ParmsName = TEXT("FTsuParms_") + StubName;
+	const TArray<UProperty*> Params = GetParameters(Function);
+
+	FString Result;
+
+	AppendToolTip(Result, Function);
+
+	// Laid out the same way as the parameter buffer, which gets verified against reflection when registered
+	if (Params.Num() > 0)
+	{
+		Result += FString::Printf(TEXT("struct %s\r\n{\r\n"), *ParmsName);
+
+		for (UProperty* Param : Params)
+			Result += FString::Printf(TEXT("\t%s %s;\r\n"), *Param->GetCPPType(), *Param->GetNameCPP());
+
+		Result += TEXT("};\r\n\r\n");
+	}
+
+	Result += FString::Printf(TEXT("static void TsuCall_%s(UObject* Object, void* Params)\r\n{\r\n"), *StubName);
+
+	if (Params.Num() > 0)
+		Result += FString::Printf(TEXT("\tauto& Parms = *static_cast<%s*>(Params);\r\n"), *ParmsName);
+
+	Result += TEXT("\t");
+
+	if (UProperty* ReturnProperty = Function->GetReturnProperty())
+		Result += FString::Printf(TEXT("Parms.%s = "), *ReturnProperty->GetNameCPP());
+
+	if (Function->HasAnyFunctionFlags(FUNC_Static))
+		Result += FString::Printf(TEXT("%s::%s("), *ClassNameCPP, *Function->GetName());
+	else
+		Result += FString::Printf(TEXT("static_cast<%s*>(Object)->%s("), *ClassNameCPP, *Function->GetName());
+
+	FString Arguments;
+	FString Offsets;
+
+	for (UProperty* Param : Params)
+	{
+		if (!Offsets.IsEmpty())
+			Offsets += TEXT(", ");
+
+		Offsets += FString::Printf(
+			TEXT("{TEXT(\"%s\"), STRUCT_OFFSET(%s, %s)}"),
+			*Param->GetName(),
+			*ParmsName,
+			*Param->GetNameCPP());
+
+		if (Param->HasAnyPropertyFlags(CPF_ReturnParm))
+			continue;
+
+		if (!Arguments.IsEmpty())
+			Arguments += TEXT(", ");
+
+		Arguments += TEXT("Parms.") + Param->GetNameCPP();
+	}
+
+	Result += Arguments;
+	Result += TEXT(");\r\n}\r\n\r\n");
+
+	OutRegistration += FString::Printf(
+		TEXT("\tBindings.AddFunction(TEXT(\"%s\"), TEXT(\"%s\"), &TsuCall_%s, {%s});\r\n"),
+		*Class->GetPathName(),
+		*Function->GetName(),
+		*StubName,
+		*Offsets);
+
+	return Result;
+}
+
+bool FTsuCodeGenerator::CanExportProperty(UClass* Class, UProperty* Property)
+{
+	using namespace TsuCodeGenerator_Private;
+
+	// Only the properties that scripts can see, and that can be accessed from outside the class
+	if (!Property->HasAllPropertyFlags(CPF_BlueprintVisible | CPF_NativeAccessSpecifierPublic))
+		return false;
+
+	if (Property->HasAnyPropertyFlags(CPF_EditorOnly))
+		return false;
+
+	if (IsFieldDeprecated(Property) || Property->ArrayDim > 1)
+		return false;
+
+	// Everything else has more to it than a conversion, and is left to reflection
+	return !GetStaticValueType(Property).IsEmpty();
+}
+
+FString FTsuCodeGenerator::GetStaticValueType(UProperty* Property)
+{
+	if (Property->IsA<UBoolProperty>())
+		return TEXT("bool");
+
+	if (Property->IsA<UStrProperty>())
+		return TEXT("FString");
+
+	if (Property->IsA<UNameProperty>())
+		return TEXT("FName");
+
+	if (auto NumericProperty = Cast<UNumericProperty>(Property))
+	{
+		if (!NumericProperty->IsEnum())
+			return Property->GetCPPType();
+	}
+
+	return FString();
+}
+
+FString FTsuCodeGenerator::ExportProperty(const FString& ClassNameCPP, UClass* Class, UProperty* Property, FString& OutRegistration)
+{
+	const FString StubName = ClassNameCPP + TEXT("_") + Property->GetName();
+	const FString ValueType = GetStaticValueType(Property);
+	const bool bIsReadOnly = Property->HasAnyPropertyFlags(CPF_BlueprintReadOnly);
+
+	FString Result;
+
+	TsuCodeGenerator_Private::AppendToolTip(Result, Property);
+
+	Result += FString::Printf(TEXT("static v8::Local<v8::Value> TsuGet_%s(const UObject* Object)\r\n{\r\n"), *StubName);
+	Result += FString::Printf(
+		TEXT("\treturn TTsuStaticValue<%s>::ToV8(static_cast<const %s*>(Object)->%s);\r\n"),
+		*ValueType,
+		*ClassNameCPP,
+		*Property->GetNameCPP());
+	Result += TEXT("}\r\n\r\n");
+
+	if (!bIsReadOnly)
+	{
+		Result += FString::Printf(TEXT("static void TsuSet_%s(UObject* Object, v8::Local<v8::Value> Value)\r\n{\r\n"), *StubName);
+		Result += FString::Printf(
+			TEXT("\tstatic_cast<%s*>(Object)->%s = TTsuStaticValue<%s>::FromV8(Value);\r\n"),
+			*ClassNameCPP,
+			*Property->GetNameCPP(),
+			*ValueType);
+		Result += TEXT("}\r\n\r\n");
+	}
+
+	OutRegistration += FString::Printf(
+		TEXT("\tBindings.AddProperty(TEXT(\"%s\"), TEXT(\"%s\"), &TsuGet_%s, %s);\r\n"),
+		*Class->GetPathName(),
+		*Property->GetName(),
+		*StubName,
+		bIsReadOnly ? TEXT("nullptr") : *(TEXT("&TsuSet_") + StubName));
+
+	return Result;
+}
+
+void FTsuCodeGenerator::FinishExport()
+{
+	GlueAllGeneratedFiles();
+	RenameTempFiles();
+}
+
+void FTsuCodeGenerator::GlueAllGeneratedFiles()
+{
+	FString Result(TEXT("#pragma once\r\n\r\n"));
+
+	for (FString& IncludePath : AllSourceClassHeaders)
+		Result += FString::Printf(TEXT("#include \"%s\"\r\n"), *IncludePath);
+
+	Result += TEXT("\r\n");
+
+	for (FString& HeaderFilename : AllScriptHeaders)
+	{
+		const FString NewFilename = FPaths::GetCleanFilename(HeaderFilename);
+		Result += FString::Printf(TEXT("#include \"%s\"\r\n"), *NewFilename);
+	}
+
+	Result += TEXT("\r\nstatic void TsuRegisterStaticBindings(FTsuStaticBindings& Bindings)\r\n{\r\n");
+
+	for (FString& RegisterFunction : AllRegisterFunctions)
+		Result += FString::Printf(TEXT("\t%s(Bindings);\r\n"), *RegisterFunction);
+
+	Result += TEXT("}\r\n");
+
+	SaveHeaderIfChanged(GeneratedCodePath / TEXT("GeneratedScriptLibraries.inl"), Result);
+}
@@ -1,28 +1,30 @@
-/**
- * #note(#mihe): This module is not currently used and is only meant to serve as a starting point for future development
- */
-
 #pragma once
 
 #include "CoreMinimal.h"
 
+/**
+ * Generates the static bindings used by FTsuStaticBindings in TsuRuntime. Each exported class gets a
+ * header with a stub per function, which calls the native function with its parameters read from a
+ * parameter buffer, and a getter/setter pair per simple property. A single glue file then includes
+ * all of those and registers them.
+ */
 class FTsuCodeGenerator
 {
 public:
 	FTsuCodeGenerator(const FString& RootLocalPath, const FString& RootBuildPath, const FString& OutputDirectory, const FString& InIncludeBase);
 
-	/** ... */
+	/** Exports the bindings of a class, if it has anything worth exporting */
 	void ExportClass(UClass* Class, const FString& SourceHeaderFilename, const FString& GeneratedHeaderFilename, bool bHasChanged);
 
-	/** ... */
+	/** Writes the glue file and moves all changed headers into place */
 	void FinishExport();
 
 private:
-	/** Exports a wrapper function */
-	FString ExportFunction(const FString& ClassNameCPP, UClass* Class, UFunction* Function);
+	/** Exports the parameter struct and stub of a function, along with its registration */
+	FString ExportFunction(const FString& ClassNameCPP, UClass* Class, UFunction* Function, FString& OutRegistration);
 
-	/** Exports a wrapper functions for properties */
-	FString ExportProperty(const FString& ClassNameCPP, UClass* Class, UProperty* Property);
+	/** Exports the getter and setter of a property, along with their registration */
+	FString ExportProperty(const FString& ClassNameCPP, UClass* Class, UProperty* Property, FString& OutRegistration);
 
 	/** @see FScriptCodeGeneratorBase::CanExportClass */
 	bool CanExportClass(UClass* Class) const;
@@ -33,14 +35,20 @@ private:
 	/** Returns true if the specified property can be exported */
 	static bool CanExportProperty(UClass* Class, UProperty* Property);
 
+	/** Returns the type that the stubs convert a property through, see TTsuStaticValue */
+	static FString GetStaticValueType(UProperty* Property);
+
 	/** Saves generated script glue heade to a temporary file if its contents is different from the eexisting one. */
 	bool SaveHeaderIfChanged(const FString& HeaderPath, const FString& NewHeaderContents);
 
 	/** Renames/replaces all existing script glue files with the temporary (new) ones */
 	void RenameTempFiles();
 
-	/** Re-bases the local path to build path */
-	FString RebaseToBuildPath(const FString& FileName) const;
+	/**
+	 * Gets the path that a class header can be included through from TsuRuntime, which depends on the
+	 * exported modules, meaning it's relative to their Public or Classes directory.
+	 */
+	bool GetIncludePath(const FString& SourceHeaderFilename, FString& OutIncludePath) const;
 
 	/** Converts a UClass name to C++ class name (with U/A prefix) */
 	FString GetClassNameCPP(UClass* Class) const;
@@ -54,9 +62,12 @@ private:
 	/** All generated script header filenames */
 	TArray<FString> AllScriptHeaders;
 
-	/** Source header filenames for all exported classes */
+	/** Include paths of the source headers for all exported classes */
 	TArray<FString> AllSourceClassHeaders;
 
+	/** Names of the functions that register the bindings of each exported class */
+	TArray<FString> AllRegisterFunctions;
+
 	/** Path where generated script glue goes **/
 	FString GeneratedCodePath;
 
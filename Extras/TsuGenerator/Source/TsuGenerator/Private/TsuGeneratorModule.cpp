@@ -1,7 +1,3 @@
-/**
- * #note(#mihe): This module is not currently used and is only meant to serve as a starting point for future development
- */
-
 #include "TsuGeneratorModule.h"
 
 #include "TsuGeneratorLog.h"
@@ -102,21 +98,18 @@ void FTsuGeneratorModule::Initialize(const FString& RootLocalPath, const FString
 
 bool FTsuGeneratorModule::ShouldExportClassesForModule(const FString& ModuleName, EBuildModuleType::Type ModuleType, const FString& ModuleGeneratedIncludeDirectory) const
 {
-	IModuleInterface* ModuleInfo = FModuleManager::Get().GetModule(FName(*ModuleName));
+	if (ModuleType != EBuildModuleType::EngineRuntime && ModuleType != EBuildModuleType::GameRuntime)
+		return false;
 
-	bool bCanExport = (ModuleType == EBuildModuleType::EngineRuntime || ModuleType == EBuildModuleType::GameRuntime);
-	if (bCanExport)
+	// Modules have to opt in, since TsuRuntime ends up depending on every module that gets exported
+	static TArray<FString> StaticBindingModules = []
 	{
-		// Only export functions from selected modules
-		static TArray<FString> SupportedModules = [] {
-			TArray<FString> Result;
-			GConfig->GetArray(TEXT("Plugins"), TEXT("ScriptSupportedModules"), Result, GEngineIni);
-			return Result;
-		}();
-
-		bCanExport = SupportedModules.Num() == 0 || SupportedModules.Contains(ModuleName);
-	}
-	return bCanExport;
+		TArray<FString> Result;
+		GConfig->GetArray(TEXT("Tsu"), TEXT("StaticBindingModules"), Result, GEngineIni);
+		return Result;
+	}();
+
+	return StaticBindingModules.Contains(ModuleName);
 }
 
 void FTsuGeneratorModule::ExportClass(UClass* Class, const FString& SourceHeaderFilename, const FString& GeneratedHeaderFilename, bool bHasChanged)
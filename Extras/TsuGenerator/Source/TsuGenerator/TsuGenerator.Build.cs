@@ -1,7 +1,3 @@
-/**
- * #note(#mihe): This module is not currently used and is only meant to serve as a starting point for future development
- */
-
 using UnrealBuildTool;
 
 public class TsuGenerator : ModuleRules
@@ -15,8 +11,7 @@ public class TsuGenerator : ModuleRules
 		PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
-				"Projects",
-				"TsuUtilities"
+				"Projects"
 			});
 
 		PublicIncludePaths.AddRange(
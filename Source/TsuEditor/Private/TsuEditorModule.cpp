@@ -108,7 +108,7 @@ private:
 		if (!IsRunningCommandlet())
 			RegisterAssetTypeActions();
 
-		FTsuTypings::WriteAllTypings();
+		FTsuTypings::WriteAllTypingsAsync();
 
 		if (GEditor)
 		{
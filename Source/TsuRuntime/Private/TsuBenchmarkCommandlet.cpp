@@ -0,0 +1,285 @@
+#include "TsuBenchmarkCommandlet.h"
+
+#include "TsuContext.h"
+#include "TsuIsolate.h"
+#include "TsuPaths.h"
+#include "TsuRuntimeLog.h"
+#include "TsuTryCatch.h"
+
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace TsuBenchmarkCommandlet_Private
+{
+
+struct FWorkload
+{
+	const TCHAR* Name;
+	const TCHAR* Body;
+	const TCHAR* Setup = TEXT("");
+};
+
+struct FResult
+{
+	FString Name;
+	double NanosecondsPerOp = 0.0;
+	double BaselineNanosecondsPerOp = 0.0;
+};
+
+// Each body runs inside `function(n) { ... }`, with `target` and `Vector` in scope; the optional
+// setup runs once at module scope, before any of the timed runs
+const FWorkload Workloads[] =
+{
+	{
+		TEXT("PropertyGet"),
+		TEXT("let sum = 0; for (let i = 0; i < n; ++i) sum += target.number; return sum;")
+	},
+	{
+		TEXT("PropertySet"),
+		TEXT("for (let i = 0; i < n; ++i) target.number = i;")
+	},
+	{
+		TEXT("StructPropertyGet"),
+		TEXT("let sum = 0; for (let i = 0; i < n; ++i) sum += target.location.x; return sum;")
+	},
+	{
+		TEXT("MethodCallStructParams"),
+		TEXT("const v = new Vector(); for (let i = 0; i < n; ++i) target.offset(v, v);")
+	},
+	{
+		TEXT("ArrayRoundTrip"),
+		TEXT("const a = [1, 2, 3, 4, 5, 6, 7, 8]; let sum = 0; for (let i = 0; i < n; ++i) sum += target.roundTrip(a).length; return sum;")
+	},
+	{
+		TEXT("DelegateBroadcast"),
+		TEXT("sum = 0; for (let i = 0; i < n; ++i) target.onEvent.broadcast(1); return sum;"),
+		TEXT("let sum = 0; target.onEvent.add(value => { sum += value; });")
+	},
+	{
+		TEXT("StructAllocation"),
+		TEXT("for (let i = 0; i < n; ++i) new Vector();")
+	},
+	{
+		TEXT("StringPassing"),
+		TEXT("let sum = 0; for (let i = 0; i < n; ++i) sum += target.echo('The quick brown fox jumps over the lazy dog').length; return sum;")
+	},
+	{
+		TEXT("Require"),
+		TEXT("for (let i = 0; i < n; ++i) require('UE/Vector');")
+	},
+};
+
+bool RunWorkload(const FWorkload& Workload, int32 Iterations, int32 Samples, FResult& OutResult)
+{
+	v8::Isolate* Isolate = FTsuIsolate::Get();
+	v8::HandleScope HandleScope{Isolate};
+
+	// clang-format off
+	const FString Code = FString::Printf(
+		TEXT("const Vector = __import('Vector');")
+		TEXT("const target = new (__import('TsuBenchmarkTarget'))();")
+		TEXT("%s")
+		TEXT("module.exports = function(n) { %s };"),
+		Workload.Setup,
+		Workload.Body);
+	// clang-format on
+
+	const FString Path = FPaths::Combine(FTsuPaths::ScriptsSourceDir(), TEXT("__benchmark__"), FString(Workload.Name) + TEXT(".js"));
+
+	v8::Local<v8::Value> Exports;
+	if (!FTsuContext::Get().EvalModule(*Code, *Path).ToLocal(&Exports) || !Exports->IsFunction())
+		return false;
+
+	v8::Local<v8::Function> Function = Exports.As<v8::Function>();
+	v8::Local<v8::Context> Context = Function->CreationContext();
+	v8::Context::Scope ContextScope{Context};
+
+	auto Run = [&](int32 NumIterations)
+	{
+		v8::HandleScope RunScope{Isolate};
+		FTsuTryCatch Catcher{Isolate};
+
+		v8::Local<v8::Value> Argument = v8::Integer::New(Isolate, NumIterations);
+		return !Function->Call(Context, Context->Global(), 1, &Argument).IsEmpty();
+	};
+
+	// Gives V8 a chance to optimize the loop before we start measuring
+	if (!Run(FMath::Max(Iterations / 10, 1)))
+		return false;
+
+	double BestTime = TNumericLimits<double>::Max();
+
+	for (int32 Sample = 0; Sample < Samples; ++Sample)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+
+		if (!Run(Iterations))
+			return false;
+
+		BestTime = FMath::Min(BestTime, FPlatformTime::Seconds() - StartTime);
+	}
+
+	OutResult.Name = Workload.Name;
+	OutResult.NanosecondsPerOp = BestTime * 1e9 / Iterations;
+
+	return true;
+}
+
+TMap<FString, double> LoadBaseline(const FString& BaselinePath)
+{
+	TMap<FString, double> Baseline;
+
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *BaselinePath))
+	{
+		UE_LOG(LogTsuRuntime, Warning, TEXT("Failed to load benchmark baseline '%s'"), *BaselinePath);
+		return Baseline;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root) || !Root.IsValid())
+	{
+		UE_LOG(LogTsuRuntime, Warning, TEXT("Failed to parse benchmark baseline '%s'"), *BaselinePath);
+		return Baseline;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* Results = nullptr;
+	if (Root->TryGetArrayField(TEXT("results"), Results))
+	{
+		for (const TSharedPtr<FJsonValue>& Result : *Results)
+		{
+			const TSharedPtr<FJsonObject>& ResultObject = Result->AsObject();
+			if (ResultObject.IsValid())
+				Baseline.Add(ResultObject->GetStringField(TEXT("name")), ResultObject->GetNumberField(TEXT("nsPerOp")));
+		}
+	}
+
+	return Baseline;
+}
+
+FString WriteResults(const TArray<FResult>& Results, int32 Iterations, int32 Samples)
+{
+	FString Json;
+
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("iterations"), Iterations);
+	Writer->WriteValue(TEXT("samples"), Samples);
+	Writer->WriteValue(TEXT("v8"), FString(v8::V8::GetVersion()));
+
+	Writer->WriteArrayStart(TEXT("results"));
+	for (const FResult& Result : Results)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("name"), Result.Name);
+		Writer->WriteValue(TEXT("nsPerOp"), Result.NanosecondsPerOp);
+
+		if (Result.BaselineNanosecondsPerOp > 0.0)
+		{
+			Writer->WriteValue(TEXT("baselineNsPerOp"), Result.BaselineNanosecondsPerOp);
+			Writer->WriteValue(TEXT("ratio"), Result.NanosecondsPerOp / Result.BaselineNanosecondsPerOp);
+		}
+
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	return Json;
+}
+
+} // namespace TsuBenchmarkCommandlet_Private
+
+UTsuBenchmarkCommandlet::UTsuBenchmarkCommandlet(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UTsuBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace TsuBenchmarkCommandlet_Private;
+
+	int32 Iterations = 10000;
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+	Iterations = FMath::Max(Iterations, 1);
+
+	int32 Samples = 5;
+	FParse::Value(*Params, TEXT("Samples="), Samples);
+	Samples = FMath::Max(Samples, 1);
+
+	FString OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Benchmarks"), TEXT("TsuBenchmark.json"));
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	FString BaselinePath;
+	FParse::Value(*Params, TEXT("Baseline="), BaselinePath);
+
+	float MaxSlowdown = 1.2f;
+	FParse::Value(*Params, TEXT("MaxSlowdown="), MaxSlowdown);
+
+	const TMap<FString, double> Baseline = BaselinePath.IsEmpty()
+		? TMap<FString, double>()
+		: LoadBaseline(BaselinePath);
+
+	TArray<FResult> Results;
+	int32 NumFailures = 0;
+
+	for (const FWorkload& Workload : Workloads)
+	{
+		FResult Result;
+		if (!RunWorkload(Workload, Iterations, Samples, Result))
+		{
+			UE_LOG(LogTsuRuntime, Error, TEXT("Benchmark '%s' failed to run"), Workload.Name);
+			++NumFailures;
+			continue;
+		}
+
+		if (const double* BaselineNanoseconds = Baseline.Find(Result.Name))
+			Result.BaselineNanosecondsPerOp = *BaselineNanoseconds;
+
+		if (Result.BaselineNanosecondsPerOp > 0.0)
+		{
+			const double Ratio = Result.NanosecondsPerOp / Result.BaselineNanosecondsPerOp;
+			if (Ratio > MaxSlowdown)
+			{
+				UE_LOG(LogTsuRuntime, Error, TEXT("%-24s %10.1f ns/op, %.2fx slower than baseline (%.1f ns/op)"),
+					*Result.Name,
+					Result.NanosecondsPerOp,
+					Ratio,
+					Result.BaselineNanosecondsPerOp);
+
+				++NumFailures;
+			}
+			else
+			{
+				UE_LOG(LogTsuRuntime, Display, TEXT("%-24s %10.1f ns/op, %.2fx of baseline"), *Result.Name, Result.NanosecondsPerOp, Ratio);
+			}
+		}
+		else
+		{
+			UE_LOG(LogTsuRuntime, Display, TEXT("%-24s %10.1f ns/op"), *Result.Name, Result.NanosecondsPerOp);
+		}
+
+		Results.Add(MoveTemp(Result));
+	}
+
+	if (!FFileHelper::SaveStringToFile(WriteResults(Results, Iterations, Samples), *OutputPath))
+	{
+		UE_LOG(LogTsuRuntime, Error, TEXT("Failed to write benchmark results to '%s'"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogTsuRuntime, Display, TEXT("Wrote benchmark results to '%s'"), *OutputPath);
+
+	return NumFailures > 0 ? 1 : 0;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "Commandlets/Commandlet.h"
+
+#include "TsuBenchmarkCommandlet.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FTsuBenchmarkEvent, float, Value);
+
+/** Object that the benchmark workloads poke at from script */
+UCLASS(ClassGroup=TSU, Transient)
+class UTsuBenchmarkTarget final
+	: public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(BlueprintReadWrite, Category="Benchmark")
+	float Number = 0.f;
+
+	UPROPERTY(BlueprintReadWrite, Category="Benchmark")
+	FVector Location = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintAssignable, Category="Benchmark")
+	FTsuBenchmarkEvent OnEvent;
+
+	UFUNCTION(BlueprintCallable, Category="Benchmark")
+	FVector Offset(FVector Vector, FVector Delta) { return Vector + Delta; }
+
+	UFUNCTION(BlueprintCallable, Category="Benchmark")
+	FString Echo(const FString& Text) { return Text; }
+
+	UFUNCTION(BlueprintCallable, Category="Benchmark")
+	TArray<float> RoundTrip(const TArray<float>& Numbers) { return Numbers; }
+};
+
+/**
+ * Runs a fixed suite of script workloads through the bridge and writes the results as JSON.
+ *
+ * -Iterations=<N>        How many times each workload loops per sample (default 10000)
+ * -Samples=<N>           How many samples to take of each workload, keeping the fastest (default 5)
+ * -Output=<Path>         Where to write the results (default Saved/Benchmarks/TsuBenchmark.json)
+ * -Baseline=<Path>       Results from an earlier run to compare against
+ * -MaxSlowdown=<Ratio>   How much slower than the baseline a workload can get before failing (default 1.2)
+ */
+UCLASS()
+class UTsuBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_UCLASS_BODY()
+
+public:
+	virtual int32 Main(const FString& Params) override;
+};
@@ -4,6 +4,9 @@
 #include "TsuIsolate.h"
 #include "TsuContext.h"
 #include "TsuCodeGenerator.h"
+#include "TsuHeapStats.h"
+#include "TsuProfiler.h"
+#include "TsuTypings.h"
 
 static const char* ToCString(const v8::String::Utf8Value& value);
 static bool ExecuteString(v8::Isolate* isolate, v8::Local<v8::String> source, v8::Local<v8::Value> name, bool print_result, bool report_exceptions);
@@ -37,6 +40,39 @@ static void JSRun(const TArray< FString >& Args)
 static void TsuCodeGenerator(const TArray<FString>& Args)
 {
 	FTsuCodeGenerator::ExportAll();
+	FTsuTypings::WriteAllTypingsAsync();
+}
+
+static void TsuArrayBufferStats(FOutputDevice& Ar)
+{
+	if (const FTsuHeapStats* HeapStats = FTsuIsolate::GetHeapStats())
+		HeapStats->DumpArrayBufferStats(Ar);
+}
+
+static void TsuProfileStart(const TArray<FString>& Args)
+{
+	const int32 SamplingIntervalUs = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 0;
+	FTsuProfiler::StartCpuProfiling(SamplingIntervalUs);
+}
+
+static void TsuProfileStop(const TArray<FString>& Args)
+{
+	const FString FilePath = Args.Num() > 0
+		? Args[0]
+		: FString::Printf(TEXT("Tsu-%s"), *FDateTime::Now().ToString());
+
+	FTsuProfiler::StopCpuProfiling(FilePath);
+}
+
+static void TsuHeapSnapshot(const TArray<FString>& Args, UWorld* /*World*/, FOutputDevice& Ar)
+{
+	const FString FilePath = Args.Num() > 0
+		? Args[0]
+		: FString::Printf(TEXT("Tsu-%s"), *FDateTime::Now().ToString());
+
+	const uint32 MinSurvivedGCs = Args.Num() > 1 ? (uint32)FCString::Atoi(*Args[1]) : 3;
+
+	FTsuProfiler::TakeHeapSnapshot(FilePath, MinSurvivedGCs, Ar);
 }
 
 static FAutoConsoleCommand CVarJSRun(
@@ -47,10 +83,35 @@ static FAutoConsoleCommand CVarJSRun(
 
 static FAutoConsoleCommand CVarTsuCodeGenerate(
 	TEXT("TsuCodeGenerate"),
-	TEXT("Generat code"),
+	TEXT("Generate code, along with typings in the background"),
 	FConsoleCommandWithArgsDelegate::CreateStatic(TsuCodeGenerator),
 	ECVF_Cheat);
 
+static FAutoConsoleCommand CVarTsuProfileStart(
+	TEXT("tsu.profile.start"),
+	TEXT("Start recording a CPU profile of scripts, optionally with a sampling interval in microseconds"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(TsuProfileStart));
+
+static FAutoConsoleCommand CVarTsuProfileStop(
+	TEXT("tsu.profile.stop"),
+	TEXT("Stop recording a CPU profile of scripts and write it to the given .cpuprofile file"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(TsuProfileStop));
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice CVarTsuHeapSnapshot(
+	TEXT("tsu.heap.snapshot"),
+	TEXT("Write a .heapsnapshot of scripts along with a report of the objects they keep alive, optionally flagging those that survived a given number of GCs (default 3)"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(TsuHeapSnapshot));
+
+static FAutoConsoleCommandWithOutputDevice CVarTsuPerformanceDump(
+	TEXT("tsu.performance.dump"),
+	TEXT("Print the most recent performance.mark and performance.measure entries"),
+	FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&FTsuProfiler::DumpPerformanceEntries));
+
+static FAutoConsoleCommandWithOutputDevice CVarTsuArrayBufferStats(
+	TEXT("tsu.arraybuffer.stats"),
+	TEXT("Print ArrayBuffer allocator usage per size bucket"),
+	FConsoleCommandWithOutputDeviceDelegate::CreateStatic(TsuArrayBufferStats));
+
 // Extracts a C string from a V8 Utf8Value.
 const char* ToCString(const v8::String::Utf8Value& value)
 {
@@ -2,11 +2,15 @@
 
 #include "TsuDelegateEvent.h"
 #include "TsuIsolate.h"
+#include "TsuNativeCalls.h"
 #include "TsuPaths.h"
 #include "TsuReflection.h"
 #include "TsuRuntimeLog.h"
+#include "TsuRuntimeStats.h"
 #include "TsuRuntimeSettings.h"
+#include "TsuStaticBindings.h"
 #include "TsuStringConv.h"
+#include "TsuTrace.h"
 #include "TsuTryCatch.h"
 #include "TsuTypings.h"
 #include "TsuUtilities.h"
@@ -16,11 +20,18 @@
 #include "Engine/Engine.h"
 #include "HAL/PlatformFile.h"
 #include "HAL/PlatformFilemanager.h"
+#include "JsonObjectConverter.h"
+#include "Misc/CoreDelegates.h"
 #include "Misc/DefaultValueHelper.h"
 #include "Misc/FileHelper.h"
+#include "Misc/MemStack.h"
 #include "Misc/Paths.h"
 #include "Misc/ScopeExit.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
 #include "TimerManager.h"
+#include "UObject/EnumProperty.h"
 #include "UObject/PropertyPortFlags.h"
 #include "UObject/TextProperty.h"
 
@@ -47,6 +58,172 @@ v8::Global<v8::Function> FTsuContext::GlobalStructHandlerConstructor;
 */
 #define ensureV8(InExpression) FTsuContext::EnsureV8(ensure(InExpression), TEXT(#InExpression))
 
+namespace TsuContext_Private
+{
+
+/** Gets the return property of a constant that has its value cached natively, rather than frozen as a V8 value */
+UStructProperty* GetCachedConstantStruct(UFunction* Constant)
+{
+	return !FTsuReflection::HasOutputParameters(Constant)
+		? Cast<UStructProperty>(Constant->GetReturnProperty())
+		: nullptr;
+}
+
+/**
+ * Whether a constant reads into a V8 value that can be shared by every access, which excludes anything
+ * that's handed to scripts as a mutable object, like arrays, maps, structs and out parameter results
+ */
+bool IsSharableConstant(UFunction* Constant)
+{
+	if (FTsuReflection::HasOutputParameters(Constant))
+		return false;
+
+	UProperty* Return = Constant->GetReturnProperty();
+	return Return != nullptr && Return->ArrayDim == 1 && (
+		Return->IsA<UNumericProperty>() ||
+		Return->IsA<UEnumProperty>() ||
+		Return->IsA<UBoolProperty>() ||
+		Return->IsA<UStrProperty>() ||
+		Return->IsA<UNameProperty>() ||
+		Return->IsA<UObjectProperty>());
+}
+
+/** The private key that struct constructors keep their type under, for builtins that take a struct type */
+v8::Local<v8::Private> GetStructTypeKey()
+{
+	return v8::Private::ForApi(FTsuIsolate::Get(), u"Tsu::StructType"_v8);
+}
+
+/** Gets the struct type that a constructor creates, provided that it's a struct constructor */
+UScriptStruct* GetStructTypeOfConstructor(v8::Local<v8::Context> Context, v8::Local<v8::Value> Constructor)
+{
+	if (!Constructor->IsFunction())
+		return nullptr;
+
+	v8::Local<v8::Value> Type;
+	if (!Constructor.As<v8::Object>()->GetPrivate(Context, GetStructTypeKey()).ToLocal(&Type) || !Type->IsExternal())
+		return nullptr;
+
+	return static_cast<UScriptStruct*>(Type.As<v8::External>()->Value());
+}
+
+/** Copies the contents of an ArrayBuffer or a view of one */
+bool ReadBytes(v8::Local<v8::Value> Value, TArray<uint8>& OutBytes)
+{
+	v8::Local<v8::ArrayBufferView> View;
+	if (Value->IsArrayBufferView())
+	{
+		View = Value.As<v8::ArrayBufferView>();
+	}
+	else if (Value->IsArrayBuffer())
+	{
+		v8::Local<v8::ArrayBuffer> Buffer = Value.As<v8::ArrayBuffer>();
+		View = v8::Uint8Array::New(Buffer, 0, Buffer->ByteLength());
+	}
+	else
+	{
+		return false;
+	}
+
+	OutBytes.SetNumUninitialized((int32)View->ByteLength());
+	View->CopyContents(OutBytes.GetData(), OutBytes.Num());
+	return true;
+}
+
+/** Copies bytes into a new ArrayBuffer */
+v8::Local<v8::ArrayBuffer> NewArrayBuffer(const TArray<uint8>& Bytes)
+{
+	v8::Local<v8::ArrayBuffer> Buffer = v8::ArrayBuffer::New(FTsuIsolate::Get(), Bytes.Num());
+
+#if V8_MAJOR_VERSION >= 8
+	void* Data = Buffer->GetBackingStore()->Data();
+#else // V8_MAJOR_VERSION >= 8
+	void* Data = Buffer->GetContents().Data();
+#endif // V8_MAJOR_VERSION >= 8
+
+	FMemory::Memcpy(Data, Bytes.GetData(), Bytes.Num());
+	return Buffer;
+}
+
+/**
+ * Writes an array of numbers to a TArray in one go, copying typed arrays of the same type straight into the
+ * TArray, and otherwise converting each element directly rather than dispatching on the property each time.
+ * Returns false if a JS array turns out to hold something other than numbers.
+ */
+template<typename T>
+bool WriteNumbers(
+	v8::Local<v8::Context> Context,
+	v8::Local<v8::Value> Value,
+	bool bIsSameType,
+	FScriptArrayHelper& ArrayHelper)
+{
+	const int32 Length = Value->IsTypedArray()
+		? (int32)Value.As<v8::TypedArray>()->Length()
+		: (int32)Value.As<v8::Array>()->Length();
+
+	ArrayHelper.EmptyValues(Length);
+	ArrayHelper.AddUninitializedValues(Length);
+
+	T* Elements = reinterpret_cast<T*>(ArrayHelper.GetRawPtr());
+
+	if (bIsSameType)
+	{
+		Value.As<v8::TypedArray>()->CopyContents(Elements, Length * sizeof(T));
+		return true;
+	}
+
+	v8::Local<v8::Object> Numbers = Value.As<v8::Object>();
+	for (int32 Index = 0; Index < Length; ++Index)
+	{
+		v8::Local<v8::Value> Element = Numbers->Get(Context, Index).ToLocalChecked();
+		if (!Element->IsNumber())
+			return false;
+
+		Elements[Index] = (T)Element.As<v8::Number>()->Value();
+	}
+
+	return true;
+}
+
+/**
+ * Writes a JS array or typed array to a TArray of numbers, returning false if either isn't the case, or if the
+ * array holds anything other than numbers, which leaves it to be written element by element instead
+ */
+bool WriteNumericArray(
+	v8::Local<v8::Context> Context,
+	v8::Local<v8::Value> Value,
+	UProperty* ElementProperty,
+	FScriptArrayHelper& ArrayHelper)
+{
+	if (!Value->IsArray() && !Value->IsTypedArray())
+		return false;
+
+	if (ElementProperty->IsA<UFloatProperty>())
+		return WriteNumbers<float>(Context, Value, Value->IsFloat32Array(), ArrayHelper);
+	else if (ElementProperty->IsA<UDoubleProperty>())
+		return WriteNumbers<double>(Context, Value, Value->IsFloat64Array(), ArrayHelper);
+	else if (ElementProperty->IsA<UIntProperty>())
+		return WriteNumbers<int32>(Context, Value, Value->IsInt32Array(), ArrayHelper);
+	else if (ElementProperty->IsA<UUInt32Property>())
+		return WriteNumbers<uint32>(Context, Value, Value->IsUint32Array(), ArrayHelper);
+	else if (ElementProperty->IsA<UInt16Property>())
+		return WriteNumbers<int16>(Context, Value, Value->IsInt16Array(), ArrayHelper);
+	else if (ElementProperty->IsA<UUInt16Property>())
+		return WriteNumbers<uint16>(Context, Value, Value->IsUint16Array(), ArrayHelper);
+	else if (ElementProperty->IsA<UInt8Property>())
+		return WriteNumbers<int8>(Context, Value, Value->IsInt8Array(), ArrayHelper);
+	else if (ElementProperty->IsA<UByteProperty>())
+		return WriteNumbers<uint8>(Context, Value, Value->IsUint8Array() || Value->IsUint8ClampedArray(), ArrayHelper);
+	else if (ElementProperty->IsA<UInt64Property>())
+		return WriteNumbers<int64>(Context, Value, false, ArrayHelper);
+	else if (ElementProperty->IsA<UUInt64Property>())
+		return WriteNumbers<uint64>(Context, Value, false, ArrayHelper);
+	else
+		return false;
+}
+
+} // namespace TsuContext_Private
+
 FTsuContext::FTsuContext()
 {
 	v8::HandleScope HandleScope{FTsuIsolate::Get()};
@@ -54,6 +231,12 @@ FTsuContext::FTsuContext()
 	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddRaw(this, &FTsuContext::OnPreGarbageCollect);
 	FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FTsuContext::OnPostGarbageCollect);
 
+	FTsuIsolate::Get()->AddGCEpilogueCallback(&FTsuContext::OnPostGarbageCollectV8, this, v8::kGCTypeMarkSweepCompact);
+
+	HandleEndFrame = FCoreDelegates::OnEndFrame.AddRaw(this, &FTsuContext::FlushConsoleMessages);
+
+	TimeOrigin = FPlatformTime::Seconds();
+
 	v8::Local<v8::Context> Context = v8::Context::New(FTsuIsolate::Get());
 
 	auto Settings = GetDefault<UTsuRuntimeSettings>();
@@ -76,6 +259,11 @@ FTsuContext::~FTsuContext()
 {
 	ITsuInspectorCallback::Get()->DestroyInspector(Inspector);
 
+	FCoreDelegates::OnEndFrame.Remove(HandleEndFrame);
+	FlushConsoleMessages();
+
+	FTsuIsolate::Get()->RemoveGCEpilogueCallback(&FTsuContext::OnPostGarbageCollectV8, this);
+
 	FCoreUObjectDelegates::GetPostGarbageCollect().RemoveAll(this);
 	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().RemoveAll(this);
 
@@ -92,6 +280,17 @@ FTsuContext::~FTsuContext()
 		FTsuIsolate::Get()->AdjustAmountOfExternalAllocatedMemory(-Type->GetStructureSize());
 	}
 
+	for (auto& Delegate : AliveDelegateCopies)
+	{
+		FDelegateCopyKey& Key = Delegate.Key;
+
+		void* Value = Key.Key;
+		UProperty* Property = Key.Value;
+
+		Property->DestroyValue(Value);
+		FMemory::Free(Value);
+	}
+
 	for (FTsuTimer& Timer : AliveTimers)
 	{
 		if (UWorld* World = Timer.World.Get())
@@ -100,6 +299,11 @@ FTsuContext::~FTsuContext()
 			TimerManager.ClearTimer(Timer.Handle);
 		}
 	}
+
+	SET_DWORD_STAT(STAT_TsuAliveStructs, 0);
+	SET_DWORD_STAT(STAT_TsuAliveObjects, 0);
+	SET_DWORD_STAT(STAT_TsuAliveDelegates, 0);
+	SET_DWORD_STAT(STAT_TsuAliveTimers, 0);
 }
 
 FTsuContext& FTsuContext::Get()
@@ -120,6 +324,7 @@ void FTsuContext::Uninitialize()
 	{
 		Get().GlobalDelegateTemplate.Reset();
 		Get().GlobalMulticastDelegateTemplate.Reset();
+		Get().GlobalDelegateCopyTemplate.Reset();
 		Get().GlobalArrayHandlerConstructor.Reset();
 		Get().GlobalArrayConstructor.Reset();
 		Get().GlobalStructHandlerConstructor.Reset();
@@ -140,6 +345,9 @@ bool FTsuContext::Exists()
 
 v8::MaybeLocal<v8::Value> FTsuContext::EvalModule(const TCHAR* Code, const TCHAR* Path)
 {
+	SCOPE_CYCLE_COUNTER(STAT_TsuEvalModule);
+	TSU_TRACE_SCOPE(TEXT("Module %s"), Path);
+
 	v8::Local<v8::Context> Context = GlobalContext.Get(FTsuIsolate::Get());
 
 	FString ModulePath = Path;
@@ -170,7 +378,17 @@ v8::MaybeLocal<v8::Value> FTsuContext::EvalModule(const TCHAR* Code, const TCHAR
 		return {};
 
 	FTsuTryCatch Catcher{ FTsuIsolate::Get() };
-	return Script->Run(Context);
+
+	v8::Local<v8::Value> Exports;
+	if (!Script->Run(Context).ToLocal(&Exports))
+		return {};
+
+	// Only kept around for attributing heap snapshots, so it shouldn't keep the module alive
+	v8::Global<v8::Value>& ExportsHandle = ModuleExports.FindOrAdd(ModulePath);
+	ExportsHandle.Reset(FTsuIsolate::Get(), Exports);
+	ExportsHandle.SetWeak();
+
+	return Exports;
 }
 
 bool FTsuContext::BindModule(const TCHAR* Binding, const TCHAR* Code, const TCHAR* Path)
@@ -276,6 +494,7 @@ void FTsuContext::InitializeBuiltins()
 	DefineMethod(Global, u"clearInterval"_v8, &FTsuContext::_OnClearTimeout);
 	DefineMethod(Global, u"__require"_v8, &FTsuContext::_OnRequire);
 	DefineMethod(Global, u"__import"_v8, &FTsuContext::_OnImport);
+	DefineMethod(Global, u"batch"_v8, &FTsuContext::_OnBatch);
 	DefineMethod(Global, u"__getProperty"_v8, &FTsuContext::_OnGetProperty);
 	DefineMethod(Global, u"__setProperty"_v8, &FTsuContext::_OnSetProperty);
 	DefineMethod(Global, u"__getArrayLength"_v8, &FTsuContext::_OnGetArrayLength);
@@ -293,6 +512,23 @@ void FTsuContext::InitializeBuiltins()
 	DefineMethod(Console, u"timeEnd"_v8, &FTsuContext::_OnConsoleTimeEnd);
 	DefineProperty(Global, u"console"_v8, Console);
 
+	v8::Local<v8::Object> Performance = v8::Object::New(FTsuIsolate::Get());
+	DefineMethod(Performance, u"now"_v8, &FTsuContext::_OnPerformanceNow);
+	DefineMethod(Performance, u"mark"_v8, &FTsuContext::_OnPerformanceMark);
+	DefineMethod(Performance, u"measure"_v8, &FTsuContext::_OnPerformanceMeasure);
+	DefineMethod(Performance, u"clearMarks"_v8, &FTsuContext::_OnPerformanceClearMarks);
+	DefineProperty(Global, u"performance"_v8, Performance);
+
+	v8::Local<v8::Object> Struct = v8::Object::New(FTsuIsolate::Get());
+	DefineMethod(Struct, u"serialize"_v8, &FTsuContext::_OnStructSerialize);
+	DefineMethod(Struct, u"deserialize"_v8, &FTsuContext::_OnStructDeserialize);
+	DefineProperty(Global, u"Struct"_v8, Struct);
+
+	v8::Local<v8::Object> Json = v8::Object::New(FTsuIsolate::Get());
+	DefineMethod(Json, u"fromStruct"_v8, &FTsuContext::_OnJsonFromStruct);
+	DefineMethod(Json, u"toStruct"_v8, &FTsuContext::_OnJsonToStruct);
+	DefineProperty(Global, u"Json"_v8, Json);
+
 	v8::Local<v8::Object> Path = v8::Object::New(FTsuIsolate::Get());
 	DefineMethod(Path, u"join"_v8, &FTsuContext::_OnPathJoin);
 	DefineMethod(Path, u"resolve"_v8, &FTsuContext::_OnPathResolve);
@@ -351,8 +587,12 @@ void FTsuContext::InitializeDelegates()
 	MulticastDelegatePrototypeTemplate->Set(u"broadcast"_v8, v8::FunctionTemplate::New(FTsuIsolate::Get(), &FTsuContext::_OnMulticastDelegateBroadcast));
 	MulticastDelegatePrototypeTemplate->SetAccessorProperty(u"isBound"_v8, v8::FunctionTemplate::New(FTsuIsolate::Get(), &FTsuContext::_OnMulticastDelegateIsBound));
 
+	v8::Local<v8::ObjectTemplate> DelegateCopyTemplate = v8::ObjectTemplate::New(FTsuIsolate::Get());
+	DelegateCopyTemplate->SetInternalFieldCount(2);
+
 	GlobalDelegateTemplate.Reset(FTsuIsolate::Get(), DelegateTemplate);
 	GlobalMulticastDelegateTemplate.Reset(FTsuIsolate::Get(), MulticastDelegateTemplate);
+	GlobalDelegateCopyTemplate.Reset(FTsuIsolate::Get(), DelegateCopyTemplate);
 }
 
 void FTsuContext::InitializeKeys()
@@ -438,6 +678,8 @@ v8::Local<v8::Function> FTsuContext::FindOrAddConstructor(UStruct* Type)
 
 v8::Local<v8::FunctionTemplate> FTsuContext::AddTemplate(UStruct* Type)
 {
+	SCOPE_CYCLE_COUNTER(STAT_TsuAddTemplate);
+
 	auto GetNonAbstractClassType = [](UStruct* Type)
 	{
 		auto ClassType = Cast<UClass>(Type);
@@ -473,6 +715,13 @@ v8::Local<v8::FunctionTemplate> FTsuContext::AddTemplate(UStruct* Type)
 
 	ConstructorTemplate->SetClassName(TCHAR_TO_V8(FTsuTypings::TailorNameOfType(Type)));
 
+	if (auto ScriptStructType = Cast<UScriptStruct>(Type))
+	{
+		ConstructorTemplate->SetPrivate(
+			TsuContext_Private::GetStructTypeKey(),
+			v8::External::New(FTsuIsolate::Get(), ScriptStructType));
+	}
+
 	v8::Local<v8::ObjectTemplate> InstanceTemplate = ConstructorTemplate->InstanceTemplate();
 	InstanceTemplate->SetInternalFieldCount(2);
 
@@ -481,18 +730,31 @@ v8::Local<v8::FunctionTemplate> FTsuContext::AddTemplate(UStruct* Type)
 	FTsuReflection::VisitProperties([&](UProperty* Property, bool bIsReadOnly)
 	{
 		v8::Local<v8::String> Name = TCHAR_TO_V8(FTsuTypings::TailorNameOfField(Property));
-		v8::Local<v8::External> Data = v8::External::New(FTsuIsolate::Get(), Property);
+		const auto Attributes = (v8::PropertyAttribute)(v8::DontDelete | (bIsReadOnly ? v8::ReadOnly : v8::None));
 
-		v8::Local<v8::FunctionTemplate> Getter = v8::FunctionTemplate::New(
-			FTsuIsolate::Get(),
-			&FTsuContext::_OnPropertyGet,
-			Data);
+		// Accessors rather than data properties, since these live on the prototype and have to see writes made through instances
+		if (auto Stubs = FTsuStaticBindings::Get().FindProperty(Property))
+		{
+			v8::Local<v8::External> StubsData = v8::External::New(FTsuIsolate::Get(), const_cast<FTsuStaticBindings::FPropertyStubs*>(Stubs));
+
+			PrototypeTemplate->SetAccessor(
+				Name,
+				&FTsuContext::_OnStaticPropertyGet,
+				bIsReadOnly ? nullptr : &FTsuContext::_OnStaticPropertySet,
+				StubsData,
+				v8::DEFAULT,
+				Attributes);
 
-		v8::Local<v8::FunctionTemplate> Setter = bIsReadOnly
-			? v8::Local<v8::FunctionTemplate>()
-			: v8::FunctionTemplate::New(FTsuIsolate::Get(), &FTsuContext::_OnPropertySet, Data);
+			return;
+		}
 
-		PrototypeTemplate->SetAccessorProperty(Name, Getter, Setter);
+		PrototypeTemplate->SetAccessor(
+			Name,
+			&FTsuContext::_OnPropertyGet,
+			bIsReadOnly ? nullptr : &FTsuContext::_OnPropertySet,
+			v8::External::New(FTsuIsolate::Get(), Property),
+			v8::DEFAULT,
+			Attributes);
 	}, Type);
 
 	FTsuReflection::VisitMethods([&](UFunction* Method)
@@ -524,9 +786,11 @@ v8::Local<v8::FunctionTemplate> FTsuContext::AddTemplate(UStruct* Type)
 	{
 		v8::Local<v8::String> Name = TCHAR_TO_V8(FTsuTypings::TailorNameOfExtension(Extension));
 
+		v8::FunctionCallback Native = FTsuNativeCalls::Find(Extension, true);
+
 		v8::Local<v8::FunctionTemplate> Callback = v8::FunctionTemplate::New(
 			FTsuIsolate::Get(),
-			&FTsuContext::_OnCallExtensionMethod,
+			Native ? Native : &FTsuContext::_OnCallExtensionMethod,
 			v8::External::New(FTsuIsolate::Get(), Extension));
 
 		PrototypeTemplate->Set(Name, Callback);
@@ -536,9 +800,11 @@ v8::Local<v8::FunctionTemplate> FTsuContext::AddTemplate(UStruct* Type)
 	{
 		v8::Local<v8::String> Name = TCHAR_TO_V8(FTsuTypings::TailorNameOfExtension(Extension));
 
+		v8::FunctionCallback Native = FTsuNativeCalls::Find(Extension, false);
+
 		v8::Local<v8::FunctionTemplate> Callback = v8::FunctionTemplate::New(
 			FTsuIsolate::Get(),
-			&FTsuContext::_OnCallStaticMethod,
+			Native ? Native : &FTsuContext::_OnCallStaticMethod,
 			v8::External::New(FTsuIsolate::Get(), Extension));
 
 		ConstructorTemplate->Set(Name, Callback);
@@ -547,13 +813,15 @@ v8::Local<v8::FunctionTemplate> FTsuContext::AddTemplate(UStruct* Type)
 	FTsuReflection::VisitExtensionConstants([&](UFunction* Extension)
 	{
 		v8::Local<v8::String> Name = TCHAR_TO_V8(FTsuTypings::TailorNameOfExtension(Extension));
+		v8::Local<v8::External> Data = v8::External::New(FTsuIsolate::Get(), Extension);
+		const auto Attributes = (v8::PropertyAttribute)(v8::ReadOnly | v8::DontDelete);
 
-		v8::Local<v8::FunctionTemplate> Callback = v8::FunctionTemplate::New(
-			FTsuIsolate::Get(),
-			&FTsuContext::_OnCallStaticMethod,
-			v8::External::New(FTsuIsolate::Get(), Extension));
-
-		ConstructorTemplate->Set(Name, Callback);
+		// Only primitives and object references are evaluated once and kept as plain data properties, anything
+		// else could be modified by scripts through the shared value, so it's read out again on every access
+		if (TsuContext_Private::IsSharableConstant(Extension))
+			ConstructorTemplate->SetLazyDataProperty(Name, &FTsuContext::_OnGetConstant, Data, Attributes);
+		else
+			ConstructorTemplate->SetNativeDataProperty(Name, &FTsuContext::_OnGetConstant, nullptr, Data, Attributes);
 	}, Type);
 
 	if (auto Class = Cast<UClass>(Type))
@@ -603,11 +871,15 @@ v8::Local<v8::Object> FTsuContext::ReferenceStructObject(void* StructObject, USc
 		FTsuIsolate::Get()->AdjustAmountOfExternalAllocatedMemory(-StructType->GetStructureSize());
 
 		Info.GetParameter()->AliveStructs.Remove(FStructKey{StructObject, StructType});
+		Info.GetParameter()->WrapperGenerations.Remove(StructObject);
+		DEC_DWORD_STAT(STAT_TsuAliveStructs);
 	};
 
 	v8::Global<v8::Object>& Observer = AliveStructs.Add(FStructKey{StructObject, StructType});
 	Observer.Reset(FTsuIsolate::Get(), Value);
 	Observer.SetWeak(this, OnCollected, v8::WeakCallbackType::kInternalFields);
+	WrapperGenerations.Add(StructObject, NumGarbageCollections);
+	INC_DWORD_STAT(STAT_TsuAliveStructs);
 
 	FTsuIsolate::Get()->AdjustAmountOfExternalAllocatedMemory(StructType->GetStructureSize());
 
@@ -639,11 +911,15 @@ v8::Local<v8::Value> FTsuContext::ReferenceClassObject(UObject* ClassObject)
 		{
 			auto ClassObject = static_cast<UObject*>(Info.GetInternalField(0));
 			Info.GetParameter()->AliveObjects.Remove(ClassObject);
+			Info.GetParameter()->WrapperGenerations.Remove(ClassObject);
+			DEC_DWORD_STAT(STAT_TsuAliveObjects);
 		};
 
 		v8::Global<v8::Object>& Observer = AliveObjects.Add(ClassObject);
 		Observer.Reset(FTsuIsolate::Get(), Value);
 		Observer.SetWeak(this, OnCollected, v8::WeakCallbackType::kInternalFields);
+		WrapperGenerations.Add(ClassObject, NumGarbageCollections);
+		INC_DWORD_STAT(STAT_TsuAliveObjects);
 	}
 
 	return Value;
@@ -673,18 +949,58 @@ v8::Local<v8::Object> FTsuContext::ReferenceDelegate(UProperty* DelegateProperty
 			auto Parent = static_cast<UObject*>(Info.GetInternalField(0));
 			auto Property = static_cast<UProperty*>(Info.GetInternalField(1));
 			Info.GetParameter()->AliveDelegates.Remove(FDelegateKey{Parent, Property});
+			Info.GetParameter()->WrapperGenerations.Remove(Property->ContainerPtrToValuePtr<void>(Parent));
+			DEC_DWORD_STAT(STAT_TsuAliveDelegates);
 		};
 
 		v8::Global<v8::Object>& Observer = AliveDelegates.Add(Key);
 		Observer.Reset(FTsuIsolate::Get(), Value);
 		Observer.SetWeak(this, OnCollected, v8::WeakCallbackType::kInternalFields);
+		WrapperGenerations.Add(DelegateProperty->ContainerPtrToValuePtr<void>(Parent), NumGarbageCollections);
+		INC_DWORD_STAT(STAT_TsuAliveDelegates);
 	}
 
 	return Value;
 }
 
+v8::Local<v8::Function> FTsuContext::CopyDelegate(UProperty* DelegateProperty, const void* Buffer)
+{
+	void* Delegate = FMemory::Malloc(DelegateProperty->ElementSize, DelegateProperty->GetMinAlignment());
+	DelegateProperty->InitializeValue(Delegate);
+	DelegateProperty->CopyCompleteValue(Delegate, Buffer);
+
+	v8::Local<v8::ObjectTemplate> DataTemplate = GlobalDelegateCopyTemplate.Get(FTsuIsolate::Get());
+
+	v8::Local<v8::Context> Context = GlobalContext.Get(FTsuIsolate::Get());
+	v8::Local<v8::Object> Data = DataTemplate->NewInstance(Context).ToLocalChecked();
+	Data->SetAlignedPointerInInternalField(0, Delegate);
+	Data->SetAlignedPointerInInternalField(1, DelegateProperty);
+
+	auto OnCollected = [](const v8::WeakCallbackInfo<FTsuContext>& Info)
+	{
+		void* Delegate = Info.GetInternalField(0);
+		auto Property = static_cast<UProperty*>(Info.GetInternalField(1));
+
+		Property->DestroyValue(Delegate);
+		FMemory::Free(Delegate);
+
+		Info.GetParameter()->AliveDelegateCopies.Remove(FDelegateCopyKey{Delegate, Property});
+		DEC_DWORD_STAT(STAT_TsuAliveDelegates);
+	};
+
+	// The function holds on to the data, so the copy lives for as long as the function does
+	v8::Global<v8::Object>& Observer = AliveDelegateCopies.Add(FDelegateCopyKey{Delegate, DelegateProperty});
+	Observer.Reset(FTsuIsolate::Get(), Data);
+	Observer.SetWeak(this, OnCollected, v8::WeakCallbackType::kInternalFields);
+	INC_DWORD_STAT(STAT_TsuAliveDelegates);
+
+	return v8::Function::New(Context, &FTsuContext::_OnDelegateCopyCall, Data).ToLocalChecked();
+}
+
 void FTsuContext::Invoke(const TCHAR* Binding, FFrame& Stack, RESULT_DECL)
 {
+	SCOPE_CYCLE_COUNTER(STAT_TsuInvoke);
+
 	v8::HandleScope HandleScope{ FTsuIsolate::Get() };
 
 	v8::Local<v8::Context> Context = GlobalContext.Get(FTsuIsolate::Get());
@@ -696,9 +1012,15 @@ void FTsuContext::Invoke(const TCHAR* Binding, FFrame& Stack, RESULT_DECL)
 	const FString FunctionName = FTsuTypings::TailorNameOfField(Function);
 	v8::Local<v8::Function> Export = GetExportedFunction(Binding, *FunctionName).ToLocalChecked();
 
+	TSU_TRACE_SCOPE(TEXT("%s.%s"), Binding, *FunctionName);
+
 	TArray<v8::Local<v8::Value>> Arguments;
 	PopArgumentsFromStack(Stack, Function, Arguments);
 
+	// The arguments still have to be popped, otherwise the stack is left in a bad state
+	if (DisabledFunctions.Num() > 0 && DisabledFunctions.Contains(Function))
+		return;
+
 	FTsuTryCatch Catcher{ FTsuIsolate::Get() };
 
 	v8::MaybeLocal<v8::Value> MaybeReturnValue = Export->Call(
@@ -707,7 +1029,10 @@ void FTsuContext::Invoke(const TCHAR* Binding, FFrame& Stack, RESULT_DECL)
 		Arguments.Num(),
 		Arguments.GetData());
 
-	Catcher.Check();
+	if (Catcher.Check())
+		HandleInvokeError(Binding, Function);
+	else if (InvokeErrors.Num() > 0)
+		InvokeErrors.Remove(Function);
 
 	v8::Local<v8::Value> ReturnValue;
 	if (!MaybeReturnValue.ToLocal(&ReturnValue))
@@ -717,12 +1042,43 @@ void FTsuContext::Invoke(const TCHAR* Binding, FFrame& Stack, RESULT_DECL)
 		WritePropertyToBuffer(ReturnProperty, ReturnValue, RESULT_PARAM);
 }
 
+void FTsuContext::HandleInvokeError(const TCHAR* Binding, UFunction* Function)
+{
+	auto Settings = GetDefault<UTsuRuntimeSettings>();
+	if (Settings->MaxConsecutiveInvokeErrors <= 0)
+		return;
+
+	FInvokeErrors& Errors = InvokeErrors.FindOrAdd(Function);
+
+	if (Errors.NumConsecutive == 0 || GFrameCounter - Errors.FirstErrorFrame >= (uint64)Settings->InvokeErrorFrameWindow)
+	{
+		Errors.NumConsecutive = 0;
+		Errors.FirstErrorFrame = GFrameCounter;
+	}
+
+	if (++Errors.NumConsecutive < Settings->MaxConsecutiveInvokeErrors)
+		return;
+
+	UE_LOG(LogTsu, Error, TEXT("'%s.%s' threw %d times in a row, so it won't be called again until scripts are reloaded"),
+		Binding,
+		*FTsuTypings::TailorNameOfField(Function),
+		Errors.NumConsecutive);
+
+	InvokeErrors.Remove(Function);
+	DisabledFunctions.Add(Function);
+}
+
 bool FTsuContext::InvokeDelegateEvent(
 	v8::Local<v8::Object> WorldContext,
 	v8::Local<v8::Function> Callback,
 	UFunction* Signature,
 	void* ParamsBuffer)
 {
+	SCOPE_CYCLE_COUNTER(STAT_TsuInvokeDelegateEvent);
+
+	// Timers are the only events created without a signature
+	TSU_TRACE_SCOPE(TEXT("%s %s"), Signature ? TEXT("Delegate") : TEXT("Timer"), *GetFunctionDisplayName(Callback));
+
 	v8::Local<v8::Context> Context = GlobalContext.Get(FTsuIsolate::Get());
 	v8::Local<v8::Object> Global = Context->Global();
 
@@ -756,6 +1112,9 @@ void FTsuContext::AddReferencedObjects(FReferenceCollector& Collector)
 	for (auto& Delegate : AliveDelegates)
 		Collector.AddReferencedObject(Delegate.Key.Key);
 
+	for (auto& Delegate : AliveDelegateCopies)
+		Collector.AddReferencedObject(Delegate.Key.Value);
+
 	for (FTsuTimer& Timer : AliveTimers)
 		Collector.AddReferencedObject(Timer.Event);
 
@@ -782,6 +1141,8 @@ void FTsuContext::OnPreGarbageCollect()
 			Iter.RemoveCurrent();
 		}
 	}
+
+	SET_DWORD_STAT(STAT_TsuAliveTimers, AliveTimers.Num());
 }
 
 void FTsuContext::OnPostGarbageCollect()
@@ -798,6 +1159,15 @@ void FTsuContext::OnPostGarbageCollect()
 	}
 }
 
+void FTsuContext::OnPostGarbageCollectV8(
+	v8::Isolate* /*Isolate*/,
+	v8::GCType /*Type*/,
+	v8::GCCallbackFlags /*Flags*/,
+	void* Data)
+{
+	++static_cast<FTsuContext*>(Data)->NumGarbageCollections;
+}
+
 v8::Local<v8::Value> FTsuContext::StartTimeout(v8::Local<v8::Function> Callback, float Delay, bool bLoop)
 {
 	v8::Local<v8::Value> WorldContextValue = GetWorldContext();
@@ -820,6 +1190,7 @@ v8::Local<v8::Value> FTsuContext::StartTimeout(v8::Local<v8::Function> Callback,
 	TimerManager.SetTimer(Handle, Delegate, Delay, bLoop);
 
 	AliveTimers.Emplace(World, Handle, Event);
+	SET_DWORD_STAT(STAT_TsuAliveTimers, AliveTimers.Num());
 
 	UScriptStruct* HandleStruct = FTimerHandle::StaticStruct();
 	void* HandleBuffer = FMemory::Malloc(HandleStruct->GetStructureSize());
@@ -829,56 +1200,100 @@ v8::Local<v8::Value> FTsuContext::StartTimeout(v8::Local<v8::Function> Callback,
 	return ReferenceStructObject(HandleBuffer, HandleStruct);
 }
 
-void FTsuContext::OnConsoleLog(const v8::FunctionCallbackInfo<v8::Value>& Info)
+void FTsuContext::LogConsoleMessage(
+	const v8::FunctionCallbackInfo<v8::Value>& Info,
+	ELogVerbosity::Type Verbosity,
+	bool bWithCallSite)
 {
-	FString ScriptName;
-	FString FunctionName;
-	int32 LineNumber = 0;
-	GetCallSite(ScriptName, FunctionName, LineNumber);
+#if NO_LOGGING
+	return;
+#else // NO_LOGGING
+	if (LogTsu.IsSuppressed(Verbosity))
+		return;
 
-	FString Message;
-	if (ensureV8(ValuesToString(ExtractArgs(Info), Message)))
+	FString& Message = ConsoleMessageBuffer;
+	Message.Reset();
+
+	if (bWithCallSite)
 	{
-		UE_LOG(LogTsu, Log, TEXT("%s"), *Message);
+		FString ScriptName;
+		FString FunctionName;
+		int32 LineNumber = 0;
+		GetCallSite(ScriptName, FunctionName, LineNumber);
+
+		Message += FString::Printf(TEXT("%s:%d: "), *ScriptName, LineNumber);
 	}
-}
 
-void FTsuContext::OnConsoleWarning(const v8::FunctionCallbackInfo<v8::Value>& Info)
-{
-	FString ScriptName;
-	FString FunctionName;
-	int32 LineNumber = 0;
-	GetCallSite(ScriptName, FunctionName, LineNumber);
+	AppendArgsToString(Info, 0, Message);
 
-	FString Message;
-	if (ensureV8(ValuesToString(ExtractArgs(Info), Message)))
+	// Warnings and errors go out right away, so they stay in order with the engine's own and aren't lost to a crash
+	auto Settings = GetDefault<UTsuRuntimeSettings>();
+	if (Settings->bBatchConsoleMessages && Verbosity > ELogVerbosity::Warning && !IsRunningCommandlet())
+	{
+		// Keeps memory in check for scripts that log lots of unique messages in a single frame
+		static const int32 MaxPendingMessages = 1024;
+
+		const FConsoleMessageKey Key{Verbosity, Message};
+
+		if (int32* Count = PendingConsoleMessages.Find(Key))
+		{
+			++*Count;
+			return;
+		}
+
+		if (PendingConsoleMessages.Num() >= MaxPendingMessages)
+			FlushConsoleMessages();
+
+		PendingConsoleMessages.Add(Key, 1);
+	}
+	else
 	{
-		UE_LOG(LogTsu, Warning, TEXT("%s"), *Message);
+		FMsg::Logf_Internal(nullptr, 0, LogTsu.GetCategoryName(), Verbosity, TEXT("%s"), *Message);
 	}
+#endif // NO_LOGGING
 }
 
-void FTsuContext::OnConsoleError(const v8::FunctionCallbackInfo<v8::Value>& Info)
+void FTsuContext::FlushConsoleMessages()
 {
-	FString ScriptName;
-	FString FunctionName;
-	int32 LineNumber = 0;
-	GetCallSite(ScriptName, FunctionName, LineNumber);
-
-	FString Message;
-	if (ensureV8(ValuesToString(ExtractArgs(Info), Message)))
+#if !NO_LOGGING
+	for (const auto& Pending : PendingConsoleMessages)
 	{
-		FMsg::Logf_Internal(
-			nullptr,
-			0,
-			LogTsu.GetCategoryName(),
-			ELogVerbosity::Error,
-			TEXT("%s"),
-			*Message);
+		const ELogVerbosity::Type Verbosity = Pending.Key.Key;
+		const FString& Message = Pending.Key.Value;
+		const int32 Count = Pending.Value;
+
+		if (Count > 1)
+			FMsg::Logf_Internal(nullptr, 0, LogTsu.GetCategoryName(), Verbosity, TEXT("%s (x%d)"), *Message, Count);
+		else
+			FMsg::Logf_Internal(nullptr, 0, LogTsu.GetCategoryName(), Verbosity, TEXT("%s"), *Message);
 	}
+#endif // !NO_LOGGING
+
+	PendingConsoleMessages.Reset();
+}
+
+void FTsuContext::OnConsoleLog(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+	LogConsoleMessage(Info, ELogVerbosity::Log, GetDefault<UTsuRuntimeSettings>()->bLogCallSite);
+}
+
+void FTsuContext::OnConsoleWarning(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+	LogConsoleMessage(Info, ELogVerbosity::Warning, GetDefault<UTsuRuntimeSettings>()->bWarningCallSite);
+}
+
+void FTsuContext::OnConsoleError(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+	LogConsoleMessage(Info, ELogVerbosity::Error, GetDefault<UTsuRuntimeSettings>()->bErrorCallSite);
 }
 
 void FTsuContext::OnConsoleTrace(const v8::FunctionCallbackInfo<v8::Value>& Info)
 {
+#if !NO_LOGGING
+	if (LogTsu.IsSuppressed(ELogVerbosity::Log))
+		return;
+#endif // !NO_LOGGING
+
 	FString Message;
 	if (ensureV8(ValuesToString(ExtractArgs(Info), Message)))
 	{
@@ -961,6 +1376,133 @@ void FTsuContext::OnConsoleTimeEnd(const v8::FunctionCallbackInfo<v8::Value>& In
 	}
 }
 
+void FTsuContext::OnPerformanceNow(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+	Info.GetReturnValue().Set((FPlatformTime::Seconds() - TimeOrigin) * 1000.0);
+}
+
+void FTsuContext::OnPerformanceMark(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+	if (!ensureV8(Info.Length() == 1))
+		return;
+
+	v8::Local<v8::Value> NameArg = Info[0];
+	if (!ensureV8(NameArg->IsString()))
+		return;
+
+	const FString Name = V8_TO_TCHAR(NameArg.As<v8::String>());
+	const double Time = FPlatformTime::Seconds() - TimeOrigin;
+
+	static const int32 MaxPerformanceMarks = 1024;
+
+	// Marks with generated names would otherwise pile up forever, so the oldest one makes room for a new name
+	if (PerformanceMarks.Num() >= MaxPerformanceMarks && !PerformanceMarks.Contains(Name))
+	{
+		FString OldestName;
+		double OldestTime = TNumericLimits<double>::Max();
+		for (const auto& Mark : PerformanceMarks)
+		{
+			if (Mark.Value < OldestTime)
+			{
+				OldestName = Mark.Key;
+				OldestTime = Mark.Value;
+			}
+		}
+
+		PerformanceMarks.Remove(OldestName);
+	}
+
+	PerformanceMarks.FindOrAdd(Name) = Time;
+	AddPerformanceEntry(Name, Time, 0.0, false);
+
+	TSU_TRACE_BOOKMARK(TEXT("%s"), *Name);
+}
+
+void FTsuContext::OnPerformanceMeasure(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+	if (!ensureV8(Info.Length() >= 1 && Info.Length() <= 3))
+		return;
+
+	v8::Local<v8::Value> NameArg = Info[0];
+	if (!ensureV8(NameArg->IsString()))
+		return;
+
+	const FString Name = V8_TO_TCHAR(NameArg.As<v8::String>());
+
+	auto FindMark = [&](int32 ArgIndex, double DefaultTime, double& OutTime)
+	{
+		v8::Local<v8::Value> MarkArg = Info[ArgIndex];
+		if (MarkArg->IsUndefined())
+		{
+			OutTime = DefaultTime;
+			return true;
+		}
+
+		if (!ensureV8(MarkArg->IsString()))
+			return false;
+
+		const FString MarkName = V8_TO_TCHAR(MarkArg.As<v8::String>());
+		if (const double* MarkTime = PerformanceMarks.Find(MarkName))
+		{
+			OutTime = *MarkTime;
+			return true;
+		}
+
+		UE_LOG(LogTsu, Error, TEXT("No performance mark named '%s'"), *MarkName);
+		return false;
+	};
+
+	double StartTime = 0.0;
+	double EndTime = 0.0;
+	if (!FindMark(1, 0.0, StartTime) || !FindMark(2, FPlatformTime::Seconds() - TimeOrigin, EndTime))
+		return;
+
+	const double Duration = EndTime - StartTime;
+	AddPerformanceEntry(Name, StartTime, Duration, true);
+
+	const double DurationMs = Duration * 1000.0;
+
+	// Trace events can't be opened after the fact, so measures show up as bookmarks with their duration
+	TSU_TRACE_BOOKMARK(TEXT("%s (%.3f ms)"), *Name, DurationMs);
+
+	Info.GetReturnValue().Set(DurationMs);
+}
+
+void FTsuContext::OnPerformanceClearMarks(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+	if (!ensureV8(Info.Length() <= 1))
+		return;
+
+	v8::Local<v8::Value> NameArg = Info[0];
+	if (NameArg->IsUndefined())
+	{
+		PerformanceMarks.Reset();
+		return;
+	}
+
+	if (!ensureV8(NameArg->IsString()))
+		return;
+
+	PerformanceMarks.Remove(V8_TO_TCHAR(NameArg.As<v8::String>()));
+}
+
+void FTsuContext::AddPerformanceEntry(const FString& Name, double StartTime, double Duration, bool bIsMeasure)
+{
+	static const int32 MaxPerformanceEntries = 1024;
+
+	FPerformanceEntry Entry{Name, StartTime, Duration, bIsMeasure};
+
+	if (PerformanceEntries.Num() < MaxPerformanceEntries)
+	{
+		PerformanceEntries.Add(MoveTemp(Entry));
+	}
+	else
+	{
+		PerformanceEntries[NextPerformanceEntry] = MoveTemp(Entry);
+		NextPerformanceEntry = (NextPerformanceEntry + 1) % MaxPerformanceEntries;
+	}
+}
+
 void FTsuContext::OnClassNew(const v8::FunctionCallbackInfo<v8::Value>& Info)
 {
 	UClass* Type = nullptr;
@@ -1049,19 +1591,91 @@ void FTsuContext::OnCallExtensionMethod(const v8::FunctionCallbackInfo<v8::Value
 	for (UProperty* Param : FParamRange(Method))
 		Param->InitializeValue_InContainer(ParamsBuffer);
 
-	ON_SCOPE_EXIT
-	{
-		for (UProperty* Param : FParamRange(Method))
-			Param->DestroyValue_InContainer(ParamsBuffer);
-	};
+	ON_SCOPE_EXIT
+	{
+		for (UProperty* Param : FParamRange(Method))
+			Param->DestroyValue_InContainer(ParamsBuffer);
+	};
+
+	UObject* Object = Method->GetOwnerClass()->GetDefaultObject();
+
+	WriteExtensionParameters(Info, Method, ParamsBuffer);
+	CallMethod(Object, Method, ParamsBuffer, Info.GetReturnValue());
+}
+
+void FTsuContext::OnGetConstant(v8::Local<v8::Name> /*Name*/, const v8::PropertyCallbackInfo<v8::Value>& Info)
+{
+	UFunction* Method = nullptr;
+	if (!ensureV8(GetExternalValue(Info.Data(), &Method)))
+		return;
+
+	UStructProperty* StructReturn = TsuContext_Private::GetCachedConstantStruct(Method);
+
+	if (StructReturn)
+	{
+		if (const TSharedPtr<FStructOnScope>* CachedStruct = ConstantStructs.Find(Method))
+		{
+			Info.GetReturnValue().Set(ReadPropertyFromBuffer(StructReturn, (*CachedStruct)->GetStructMemory()));
+			return;
+		}
+	}
+
+	void* ParamsBuffer = FMemory_Alloca(Method->ParmsSize);
+
+	for (UProperty* Param : FParamRange(Method))
+		Param->InitializeValue_InContainer(ParamsBuffer);
+
+	ON_SCOPE_EXIT
+	{
+		for (UProperty* Param : FParamRange(Method))
+			Param->DestroyValue_InContainer(ParamsBuffer);
+	};
+
+	UObject* Object = Method->GetOwnerClass()->GetDefaultObject();
+
+	if (StructReturn)
+	{
+		Object->ProcessEvent(Method, ParamsBuffer);
+
+		auto CachedStruct = MakeShared<FStructOnScope>(StructReturn->Struct);
+		StructReturn->CopyCompleteValue(CachedStruct->GetStructMemory(), StructReturn->ContainerPtrToValuePtr<void>(ParamsBuffer));
+		ConstantStructs.Add(Method, CachedStruct);
+
+		Info.GetReturnValue().Set(ReadPropertyFromBuffer(StructReturn, CachedStruct->GetStructMemory()));
+	}
+	else
+	{
+		CallMethod(Object, Method, ParamsBuffer, Info.GetReturnValue());
+	}
+}
+
+void FTsuContext::OnStaticPropertyGet(v8::Local<v8::Name> /*Name*/, const v8::PropertyCallbackInfo<v8::Value>& Info)
+{
+	FTsuStaticBindings::FPropertyStubs* Stubs = nullptr;
+	if (!ensureV8(GetExternalValue(Info.Data(), &Stubs)))
+		return;
+
+	UObject* Self = nullptr;
+	if (!ensureV8(GetInternalFields(Info.This(), &Self)))
+		return;
+
+	Info.GetReturnValue().Set(Stubs->Getter(Self));
+}
 
-	UObject* Object = Method->GetOwnerClass()->GetDefaultObject();
+void FTsuContext::OnStaticPropertySet(v8::Local<v8::Name> /*Name*/, v8::Local<v8::Value> Value, const v8::PropertyCallbackInfo<void>& Info)
+{
+	FTsuStaticBindings::FPropertyStubs* Stubs = nullptr;
+	if (!ensureV8(GetExternalValue(Info.Data(), &Stubs)))
+		return;
 
-	WriteExtensionParameters(Info, Method, ParamsBuffer);
-	CallMethod(Object, Method, ParamsBuffer, Info.GetReturnValue());
+	UObject* Self = nullptr;
+	if (!ensureV8(GetInternalFields(Info.This(), &Self)))
+		return;
+
+	Stubs->Setter(Self, Value);
 }
 
-void FTsuContext::OnPropertyGet(const v8::FunctionCallbackInfo<v8::Value>& Info)
+void FTsuContext::OnPropertyGet(v8::Local<v8::Name> /*Name*/, const v8::PropertyCallbackInfo<v8::Value>& Info)
 {
 	v8::Local<v8::Context> Context = GlobalContext.Get(FTsuIsolate::Get());
 
@@ -1152,11 +1766,8 @@ void FTsuContext::OnPropertyGet(const v8::FunctionCallbackInfo<v8::Value>& Info)
 	}
 }
 
-void FTsuContext::OnPropertySet(const v8::FunctionCallbackInfo<v8::Value>& Info)
+void FTsuContext::OnPropertySet(v8::Local<v8::Name> /*Name*/, v8::Local<v8::Value> Value, const v8::PropertyCallbackInfo<void>& Info)
 {
-	if (!ensureV8(Info.Length() == 1))
-		return;
-
 	UProperty* Property = nullptr;
 	if (!ensureV8(GetExternalValue(Info.Data(), &Property)))
 		return;
@@ -1167,7 +1778,7 @@ void FTsuContext::OnPropertySet(const v8::FunctionCallbackInfo<v8::Value>& Info)
 	if (!ensureV8(GetInternalFields(This, &Self)))
 		return;
 
-	if (!ensureV8(WritePropertyToContainer(Property, Info[0], Self)))
+	if (!ensureV8(WritePropertyToContainer(Property, Value, Self)))
 		return;
 }
 
@@ -1335,6 +1946,8 @@ void FTsuContext::OnClearTimeout(const v8::FunctionCallbackInfo<v8::Value>& Info
 			break;
 		}
 	}
+
+	SET_DWORD_STAT(STAT_TsuAliveTimers, AliveTimers.Num());
 }
 
 void FTsuContext::OnPathJoin(const v8::FunctionCallbackInfo<v8::Value>& Info)
@@ -1517,6 +2130,248 @@ void FTsuContext::OnSetProperty(const v8::FunctionCallbackInfo<v8::Value>& Info)
 	Info.GetReturnValue().Set(true);
 }
 
+void FTsuContext::OnBatch(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+	if (!ensureV8(Info.Length() == 2 && Info[1]->IsFunction()))
+		return;
+
+	v8::Isolate* Isolate = FTsuIsolate::Get();
+	v8::Local<v8::Context> Context = GlobalContext.Get(Isolate);
+
+	// Struct proxies copy the struct out and back in on every write, so the writes go to one copy instead
+	v8::Local<v8::Value> Target = UnwrapStructProxy(Info[0]);
+
+	void* Self = nullptr;
+	UStruct* Type = nullptr;
+	if (!ensureV8(GetInternalFields(Target, &Self, &Type)))
+		return;
+
+	v8::Local<v8::Object> Writes = v8::Object::New(Isolate, v8::Null(Isolate), nullptr, nullptr, 0);
+	v8::Local<v8::Value> Args[] = {Writes};
+
+	// Leaves the target untouched if the callback throws
+	if (Info[1].As<v8::Function>()->Call(Context, v8::Undefined(Isolate), ARRAY_COUNT(Args), Args).IsEmpty())
+		return;
+
+	const TMap<FString, UProperty*>& Properties = GetWritableProperties(Type);
+
+	struct FPendingWrite
+	{
+		UProperty* Property;
+		void* Scratch;
+	};
+
+	FMemMark ScratchMark{FMemStack::Get()};
+	TArray<FPendingWrite, TInlineAllocator<16>> PendingWrites;
+
+	auto DestroyPendingWrites = [&]
+	{
+		for (const FPendingWrite& PendingWrite : PendingWrites)
+			PendingWrite.Property->DestroyValue(PendingWrite.Scratch);
+	};
+
+	// Stages every write before touching the target, so that a typo leaves it as it was
+	v8::Local<v8::Array> Names = Writes->GetOwnPropertyNames(Context).ToLocalChecked();
+	for (uint32 Index = 0; Index < Names->Length(); ++Index)
+	{
+		v8::Local<v8::String> Name = Names->Get(Context, Index).ToLocalChecked()->ToString(Context).ToLocalChecked();
+		const FString PropertyName = V8_TO_TCHAR(Name);
+
+		UProperty* const* Property = Properties.Find(PropertyName);
+		if (Property == nullptr || (*Property)->ArrayDim > 1)
+		{
+			DestroyPendingWrites();
+
+			const FString Message = FString::Printf(
+				TEXT("'%s' is not a writable property of '%s'"),
+				*PropertyName,
+				*Type->GetName());
+
+			Isolate->ThrowException(v8::Exception::TypeError(TCHAR_TO_V8(Message)));
+			return;
+		}
+
+		void* Scratch = FMemStack::Get().Alloc((*Property)->ElementSize, (*Property)->GetMinAlignment());
+		(*Property)->InitializeValue(Scratch);
+		PendingWrites.Add({*Property, Scratch});
+
+		v8::Local<v8::Value> Value = Writes->Get(Context, Name).ToLocalChecked();
+		if (!WritePropertyToBuffer(*Property, Value, Scratch))
+		{
+			DestroyPendingWrites();
+
+			const FString Message = FString::Printf(
+				TEXT("Failed to write property '%s' of '%s'"),
+				*PropertyName,
+				*Type->GetName());
+
+			Isolate->ThrowException(v8::Exception::TypeError(TCHAR_TO_V8(Message)));
+			return;
+		}
+	}
+
+	for (const FPendingWrite& PendingWrite : PendingWrites)
+		PendingWrite.Property->CopyCompleteValue(PendingWrite.Property->ContainerPtrToValuePtr<void>(Self), PendingWrite.Scratch);
+
+	DestroyPendingWrites();
+
+	if (Info[0]->IsProxy())
+	{
+		v8::Local<v8::Object> Handler = Info[0].As<v8::Proxy>()->GetHandler().As<v8::Object>();
+		Handler->Set(Context, u"actualObject"_v8, Target).ToChecked();
+	}
+
+	Info.GetReturnValue().Set(Info[0]);
+}
+
+const TMap<FString, UProperty*>& FTsuContext::GetWritableProperties(UStruct* Type)
+{
+	if (const TMap<FString, UProperty*>* Found = WritableProperties.Find(Type))
+		return *Found;
+
+	TMap<FString, UProperty*>& Result = WritableProperties.Add(Type);
+
+	FTsuReflection::VisitProperties([&](UProperty* Property, bool bIsReadOnly)
+	{
+		if (!bIsReadOnly)
+			Result.Add(FTsuTypings::TailorNameOfField(Property), Property);
+	}, Type, true);
+
+	return Result;
+}
+
+void FTsuContext::OnStructSerialize(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+	if (!ensureV8(Info.Length() == 1))
+		return;
+
+	void* Object = nullptr;
+	UStruct* Type = nullptr;
+	if (!ensureV8(GetInternalFields(UnwrapStructProxy(Info[0]), &Object, &Type)))
+		return;
+
+	auto StructType = Cast<UScriptStruct>(Type);
+	if (!ensureV8(StructType != nullptr))
+		return;
+
+	// Only what differs from the defaults gets written, which deserializing starts out from
+	FStructOnScope Defaults{StructType};
+
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer{Bytes};
+	FObjectAndNameAsStringProxyArchive Archive{Writer, false};
+	StructType->SerializeItem(Archive, Object, Defaults.GetStructMemory());
+
+	Info.GetReturnValue().Set(TsuContext_Private::NewArrayBuffer(Bytes));
+}
+
+void FTsuContext::OnStructDeserialize(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+	if (!ensureV8(Info.Length() == 2))
+		return;
+
+	v8::Local<v8::Context> Context = GlobalContext.Get(FTsuIsolate::Get());
+
+	UScriptStruct* Type = TsuContext_Private::GetStructTypeOfConstructor(Context, Info[0]);
+	if (!ensureV8(Type != nullptr))
+		return;
+
+	TArray<uint8> Bytes;
+	if (!ensureV8(TsuContext_Private::ReadBytes(Info[1], Bytes)))
+		return;
+
+	void* Object = FMemory::Malloc(Type->GetStructureSize());
+	Type->InitializeStruct(Object);
+
+	// The bytes come from scripts, so no length read from them gets to allocate more than there is to read,
+	// and no object reference in them gets to load anything
+	FMemoryReader Reader{Bytes};
+	Reader.ArMaxSerializeSize = Bytes.Num();
+	FObjectAndNameAsStringProxyArchive Archive{Reader, false};
+	Type->SerializeItem(Archive, Object, nullptr);
+
+	if (Archive.IsError() || Reader.IsError())
+	{
+		Type->DestroyStruct(Object);
+		FMemory::Free(Object);
+
+		const FString Message = FString::Printf(
+			TEXT("Failed to deserialize '%s' from %d bytes"),
+			*Type->GetName(),
+			Bytes.Num());
+
+		FTsuIsolate::Get()->ThrowException(v8::Exception::TypeError(TCHAR_TO_V8(Message)));
+		return;
+	}
+
+	Info.GetReturnValue().Set(ReferenceStructObject(Object, Type));
+}
+
+void FTsuContext::OnJsonFromStruct(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+	if (!ensureV8(Info.Length() == 1))
+		return;
+
+	void* Object = nullptr;
+	UStruct* Type = nullptr;
+	if (!ensureV8(GetInternalFields(UnwrapStructProxy(Info[0]), &Object, &Type)))
+		return;
+
+	FString Json;
+	if (!ensureV8(FJsonObjectConverter::UStructToJsonObjectString(Type, Object, Json, 0, 0, 0, nullptr, false)))
+		return;
+
+	Info.GetReturnValue().Set(TCHAR_TO_V8(Json));
+}
+
+void FTsuContext::OnJsonToStruct(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+	if (!ensureV8(Info.Length() == 2))
+		return;
+
+	v8::Local<v8::Context> Context = GlobalContext.Get(FTsuIsolate::Get());
+
+	UScriptStruct* Type = TsuContext_Private::GetStructTypeOfConstructor(Context, Info[0]);
+	if (!ensureV8(Type != nullptr))
+		return;
+
+	if (!ensureV8(Info[1]->IsString()))
+		return;
+
+	v8::Isolate* Isolate = FTsuIsolate::Get();
+
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(V8_TO_TCHAR(Info[1].As<v8::String>()));
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	{
+		const FString Message = FString::Printf(
+			TEXT("Failed to parse JSON for '%s': %s"),
+			*Type->GetName(),
+			*Reader->GetErrorMessage());
+
+		Isolate->ThrowException(v8::Exception::SyntaxError(TCHAR_TO_V8(Message)));
+		return;
+	}
+
+	void* Object = FMemory::Malloc(Type->GetStructureSize());
+	Type->InitializeStruct(Object);
+
+	if (!FJsonObjectConverter::JsonObjectToUStruct(JsonObject.ToSharedRef(), Type, Object, 0, 0))
+	{
+		Type->DestroyStruct(Object);
+		FMemory::Free(Object);
+
+		const FString Message = FString::Printf(
+			TEXT("JSON does not match the properties of '%s'"),
+			*Type->GetName());
+
+		Isolate->ThrowException(v8::Exception::TypeError(TCHAR_TO_V8(Message)));
+		return;
+	}
+
+	Info.GetReturnValue().Set(ReferenceStructObject(Object, Type));
+}
+
 void FTsuContext::OnGetStaticClass(const v8::FunctionCallbackInfo<v8::Value>& Info)
 {
 	UClass* Class = nullptr;
@@ -1697,26 +2552,107 @@ void FTsuContext::OnMulticastDelegateIsBound(const v8::FunctionCallbackInfo<v8::
 	Info.GetReturnValue().Set(MulticastDelegate->IsBound());
 }
 
+void FTsuContext::OnDelegateCopyCall(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+	void* Delegate = nullptr;
+	UProperty* Property = nullptr;
+	if (!ensureV8(GetInternalFields(Info.Data(), &Delegate, &Property)))
+		return;
+
+	auto DelegateProperty = Cast<UDelegateProperty>(Property);
+	auto MulticastDelegateProperty = Cast<UMulticastDelegateProperty>(Property);
+
+	UFunction* SignatureFunction = DelegateProperty
+		? DelegateProperty->SignatureFunction
+		: MulticastDelegateProperty->SignatureFunction;
+
+	void* ParamsBuffer = FMemory_Alloca(SignatureFunction->ParmsSize);
+
+	for (UProperty* Param : FParamRange(SignatureFunction))
+		Param->InitializeValue_InContainer(ParamsBuffer);
+
+	ON_SCOPE_EXIT
+	{
+		for (UProperty* Param : FParamRange(SignatureFunction))
+			Param->DestroyValue_InContainer(ParamsBuffer);
+	};
+
+	const int32 NumArgs = Info.Length();
+
+	int32 ArgIndex = 0;
+	FTsuReflection::VisitFunctionParameters([&](UProperty* Parameter)
+	{
+		if (ArgIndex < NumArgs)
+			WritePropertyToContainer(Parameter, Info[ArgIndex++], ParamsBuffer);
+	}, SignatureFunction, false, false);
+
+	if (DelegateProperty)
+		static_cast<FScriptDelegate*>(Delegate)->ProcessDelegate<UObject>(ParamsBuffer);
+	else
+		static_cast<FMulticastScriptDelegate*>(Delegate)->ProcessMulticastDelegate<UObject>(ParamsBuffer);
+
+	ReadReturnValues(SignatureFunction, ParamsBuffer, Info.GetReturnValue());
+}
+
+const FTsuContext::FReturnTemplate& FTsuContext::GetReturnTemplate(UFunction* Method)
+{
+	if (const FReturnTemplate* Found = ReturnTemplates.Find(Method))
+		return *Found;
+
+	v8::Isolate* Isolate = FTsuIsolate::Get();
+
+	FReturnTemplate& Result = ReturnTemplates.Add(Method);
+
+	v8::Local<v8::ObjectTemplate> Template = v8::ObjectTemplate::New(Isolate);
+
+	FTsuReflection::VisitFunctionReturns([&](UProperty* Return)
+	{
+		v8::Local<v8::String> Name = TCHAR_TO_V8(FTsuTypings::TailorNameOfField(Return));
+		Template->Set(Name, v8::Undefined(Isolate));
+
+		Result.Returns.Add(Return);
+		Result.Names.Emplace(Isolate, Name);
+	}, Method);
+
+	Result.Template.Reset(Isolate, Template);
+
+	return Result;
+}
+
 void FTsuContext::CallMethod(
 	UObject* Object,
 	UFunction* Method,
 	void* ParamsBuffer,
 	v8::ReturnValue<v8::Value> ReturnValue)
 {
-	Object->ProcessEvent(Method, ParamsBuffer);
+	SCOPE_CYCLE_COUNTER(STAT_TsuCallMethod);
+
+	if (FTsuStaticBindings::FFunctionStub Stub = FTsuStaticBindings::Get().FindFunction(Method))
+		Stub(Object, ParamsBuffer);
+	else
+		Object->ProcessEvent(Method, ParamsBuffer);
+
+	ReadReturnValues(Method, ParamsBuffer, ReturnValue);
+}
 
+void FTsuContext::ReadReturnValues(
+	UFunction* Method,
+	void* ParamsBuffer,
+	v8::ReturnValue<v8::Value> ReturnValue)
+{
 	if (FTsuReflection::HasOutputParameters(Method))
 	{
-		v8::Local<v8::Context> Context = GlobalContext.Get(FTsuIsolate::Get());
+		v8::Isolate* Isolate = FTsuIsolate::Get();
+		v8::Local<v8::Context> Context = GlobalContext.Get(Isolate);
 
-		v8::Local<v8::Object> ReturnObject = v8::Object::New(FTsuIsolate::Get());
+		const FReturnTemplate& ReturnTemplate = GetReturnTemplate(Method);
+		v8::Local<v8::Object> ReturnObject = ReturnTemplate.Template.Get(Isolate)->NewInstance(Context).ToLocalChecked();
 
-		FTsuReflection::VisitFunctionReturns([&](UProperty* Return)
+		for (int32 Index = 0; Index < ReturnTemplate.Returns.Num(); ++Index)
 		{
-			const FString Name = FTsuTypings::TailorNameOfField(Return);
-			v8::Local<v8::Value> Value = ReadPropertyFromContainer(Return, ParamsBuffer);
-			ReturnObject->Set(Context, TCHAR_TO_V8(Name), Value).ToChecked();
-		}, Method);
+			v8::Local<v8::Value> Value = ReadPropertyFromContainer(ReturnTemplate.Returns[Index], ParamsBuffer);
+			ReturnObject->Set(Context, ReturnTemplate.Names[Index].Get(Isolate), Value).ToChecked();
+		}
 
 		ReturnValue.Set(ReturnObject);
 	}
@@ -1731,6 +2667,8 @@ void FTsuContext::WriteParameters(
 	UFunction* Method,
 	void* ParamsBuffer)
 {
+	SCOPE_CYCLE_COUNTER(STAT_TsuWriteParameters);
+
 	FName WorldContextName;
 	if (Method->HasMetaData(MetaWorldContext))
 		WorldContextName = *Method->GetMetaData(MetaWorldContext);
@@ -1775,6 +2713,8 @@ void FTsuContext::WriteExtensionParameters(
 	UFunction* Method,
 	void* ParamsBuffer)
 {
+	SCOPE_CYCLE_COUNTER(STAT_TsuWriteParameters);
+
 	FName WorldContextName;
 	if (Method->HasMetaData(MetaWorldContext))
 		WorldContextName = *Method->GetMetaData(MetaWorldContext);
@@ -1825,6 +2765,11 @@ void FTsuContext::PopArgumentsFromStack(
 	UFunction* Function,
 	TArray<v8::Local<v8::Value>>& OutArguments)
 {
+	SCOPE_CYCLE_COUNTER(STAT_TsuPopArguments);
+
+	// Releases the scratch memory of every argument once they've all been converted
+	FMemMark ScratchMark{FMemStack::Get()};
+
 	for (
 		UProperty* Argument = (UProperty*)Function->Children;
 		Argument != nullptr;
@@ -1842,32 +2787,18 @@ void FTsuContext::PopArgumentFromStack(
 	UProperty* Argument,
 	TArray<v8::Local<v8::Value>>& OutArguments)
 {
-	if (Argument->IsA<UStrProperty>())
-	{
-		FString PropertyValue;
-		Stack.StepCompiledIn<UStrProperty>(&PropertyValue);
-		OutArguments.Add(TCHAR_TO_V8(PropertyValue));
-	}
-	else if (Argument->IsA<UBoolProperty>())
+	if (Argument->IsA<UBoolProperty>())
 	{
-		bool PropertyValue = false;
+		// The VM may write a full word for booleans, see P_GET_UBOOL
+		uint32 PropertyValue = 0;
 		Stack.StepCompiledIn<UBoolProperty>(&PropertyValue);
-		OutArguments.Add(v8::Boolean::New(FTsuIsolate::Get(), PropertyValue));
-	}
-	else if (Argument->IsA<UFloatProperty>())
-	{
-		float PropertyValue = 0.f;
-		Stack.StepCompiledIn<UFloatProperty>(&PropertyValue);
-		OutArguments.Add(v8::Number::New(FTsuIsolate::Get(), (double)PropertyValue));
-	}
-	else if (Argument->IsA<UObjectPropertyBase>())
-	{
-		UObject* PropertyValue = nullptr;
-		Stack.StepCompiledIn<UObjectPropertyBase>(&PropertyValue);
-		OutArguments.Add(ReferenceClassObject(PropertyValue));
+		OutArguments.Add(v8::Boolean::New(FTsuIsolate::Get(), !!PropertyValue));
 	}
 	else if (auto StructArgument = Cast<UStructProperty>(Argument))
 	{
+		INC_DWORD_STAT_BY(STAT_TsuMarshalledBytes, Argument->ElementSize);
+
+		// Stepped straight into the memory that the wrapper takes ownership of, rather than copied out of scratch memory
 		UScriptStruct* Struct = StructArgument->Struct;
 
 		void* PropertyValue = FMemory::Malloc(Struct->GetStructureSize());
@@ -1876,25 +2807,16 @@ void FTsuContext::PopArgumentFromStack(
 		Stack.StepCompiledIn<UStructProperty>(PropertyValue);
 		OutArguments.Add(ReferenceStructObject(PropertyValue, StructArgument->Struct));
 	}
-	else if (auto EnumArgument = Cast<UEnumProperty>(Argument))
-	{
-		PopArgumentFromStack(Stack, EnumArgument->GetUnderlyingProperty(), OutArguments);
-	}
-	else if (Argument->IsA<UByteProperty>())
-	{
-		int8 PropertyValue = 0;
-		Stack.StepCompiledIn<UByteProperty>(&PropertyValue);
-		OutArguments.Add(v8::Integer::New(FTsuIsolate::Get(), PropertyValue));
-	}
-	else if (Argument->IsA<UArrayProperty>())
-	{
-		Stack.StepCompiledIn<UArrayProperty>(nullptr);
-		OutArguments.Add(ReadPropertyFromBuffer(Argument, Stack.MostRecentPropertyAddress));
-	}
 	else
 	{
-		UE_LOG(LogTsuRuntime, Error, TEXT("Unhandled type: %s"), *Argument->GetCPPType());
-		checkNoEntry();
+		// Only used if the value has to be evaluated, otherwise we're handed the address of the value in the caller's frame
+		void* Scratch = FMemStack::Get().Alloc(Argument->ElementSize, Argument->GetMinAlignment());
+		Argument->InitializeValue(Scratch);
+
+		const void* PropertyValue = &Stack.StepCompiledInRef<UProperty, uint8>(Scratch);
+		OutArguments.Add(ReadPropertyFromBuffer(Argument, PropertyValue));
+
+		Argument->DestroyValue(Scratch);
 	}
 }
 
@@ -1903,6 +2825,8 @@ bool FTsuContext::WritePropertyToContainer(
 	v8::Local<v8::Value> Value,
 	void* Buffer)
 {
+	SCOPE_CYCLE_COUNTER(STAT_TsuWriteProperty);
+
 	if (Property->ArrayDim > 1)
 	{
 		// #todo(#mihe)
@@ -1920,6 +2844,8 @@ bool FTsuContext::WritePropertyToBuffer(
 	v8::Local<v8::Value> Value,
 	void* Buffer)
 {
+	INC_DWORD_STAT_BY(STAT_TsuMarshalledBytes, Property->ElementSize);
+
 	if (auto StrProperty = Cast<UStrProperty>(Property))
 	{
 		const FString String = V8_TO_TCHAR(Value.As<v8::String>());
@@ -1973,6 +2899,15 @@ bool FTsuContext::WritePropertyToBuffer(
 			ObjectProperty->SetObjectPropertyValue(Buffer, Object);
 		}
 	}
+	else if (auto InterfaceProperty = Cast<UInterfaceProperty>(Property))
+	{
+		UObject* Object = nullptr;
+		if (!Value->IsNull())
+			verify(GetInternalFields(Value, &Object));
+
+		void* InterfaceAddress = Object ? Object->GetInterfaceAddress(InterfaceProperty->InterfaceClass) : nullptr;
+		InterfaceProperty->SetPropertyValue(Buffer, FScriptInterface(InterfaceAddress ? Object : nullptr, InterfaceAddress));
+	}
 	else if (auto StructProperty = Cast<UStructProperty>(Property))
 	{
 		Value = UnwrapStructProxy(Value);
@@ -1987,12 +2922,15 @@ bool FTsuContext::WritePropertyToBuffer(
 
 		FScriptArrayHelper ArrayHelper{ArrayProperty, Buffer};
 
+		UProperty* ElementProperty = ArrayProperty->Inner;
+
+		if (TsuContext_Private::WriteNumericArray(Context, Value, ElementProperty, ArrayHelper))
+			return true;
+
 		v8::Local<v8::Array> ArrayValue = Value.As<v8::Array>();
 		const int32 ArrayLength = GetArrayLikeLength(ArrayValue);
 		ArrayHelper.Resize(ArrayLength);
 
-		UProperty* ElementProperty = ArrayProperty->Inner;
-
 		for (int32 ElementIndex = 0; ElementIndex < ArrayLength; ++ElementIndex)
 		{
 			v8::Local<v8::Value> ElementValue = ArrayValue->Get(Context, ElementIndex).ToLocalChecked();
@@ -2157,6 +3095,8 @@ void FTsuContext::WriteDefaultValue(UFunction* Method, UProperty* Param, void* B
 
 v8::Local<v8::Value> FTsuContext::ReadPropertyFromContainer(UProperty* Property, const void* Buffer)
 {
+	SCOPE_CYCLE_COUNTER(STAT_TsuReadProperty);
+
 	if (Property->ArrayDim > 1)
 	{
 		v8::Local<v8::Context> Context = GlobalContext.Get(FTsuIsolate::Get());
@@ -2180,6 +3120,8 @@ v8::Local<v8::Value> FTsuContext::ReadPropertyFromContainer(UProperty* Property,
 
 v8::Local<v8::Value> FTsuContext::ReadPropertyFromBuffer(UProperty* Property, const void* Buffer)
 {
+	INC_DWORD_STAT_BY(STAT_TsuMarshalledBytes, Property->ElementSize);
+
 	v8::Local<v8::Context> Context = GlobalContext.Get(FTsuIsolate::Get());
 
 	if (auto StrProperty = Cast<UStrProperty>(Property))
@@ -2213,6 +3155,15 @@ v8::Local<v8::Value> FTsuContext::ReadPropertyFromBuffer(UProperty* Property, co
 	{
 		return ReferenceClassObject(ObjectProperty->GetObjectPropertyValue(Buffer));
 	}
+	else if (auto InterfaceProperty = Cast<UInterfaceProperty>(Property))
+	{
+		return ReferenceClassObject(InterfaceProperty->GetPropertyValue(Buffer).GetObject());
+	}
+	else if (Property->IsA<UDelegateProperty>() || Property->IsA<UMulticastDelegateProperty>())
+	{
+		// Delegates read from a buffer have no parent to reference, such as arguments popped off the stack
+		return CopyDelegate(Property, Buffer);
+	}
 	else if (auto StructProperty = Cast<UStructProperty>(Property))
 	{
 		UScriptStruct* Type = StructProperty->Struct;
@@ -2244,8 +3195,14 @@ v8::Local<v8::Value> FTsuContext::ReadPropertyFromBuffer(UProperty* Property, co
 		v8::Local<v8::Set> Set = v8::Set::New(FTsuIsolate::Get());
 		UProperty* ElementProperty = SetProperty->ElementProp;
 
-		for (int32 ElementIndex = 0; ElementIndex < SetHelper.Num(); ++ElementIndex)
+		// The storage is sparse, so the indices of the elements can go past the number of elements
+		for (int32 ElementIndex = 0, NumLeft = SetHelper.Num(); NumLeft > 0; ++ElementIndex)
 		{
+			if (!SetHelper.IsValidIndex(ElementIndex))
+				continue;
+
+			--NumLeft;
+
 			const void* ElementBuffer = SetHelper.GetElementPtr(ElementIndex);
 			v8::Local<v8::Value> ElementValue = ReadPropertyFromBuffer(ElementProperty, ElementBuffer);
 			Set->Add(Context, ElementValue).ToLocalChecked();
@@ -2262,8 +3219,13 @@ v8::Local<v8::Value> FTsuContext::ReadPropertyFromBuffer(UProperty* Property, co
 		UProperty* KeyProperty = MapHelper.GetKeyProperty();
 		UProperty* ValueProperty = MapHelper.GetValueProperty();
 
-		for (int32 ElementIndex = 0; ElementIndex < MapHelper.Num(); ++ElementIndex)
+		for (int32 ElementIndex = 0, NumLeft = MapHelper.Num(); NumLeft > 0; ++ElementIndex)
 		{
+			if (!MapHelper.IsValidIndex(ElementIndex))
+				continue;
+
+			--NumLeft;
+
 			const void* KeyBuffer = MapHelper.GetKeyPtr(ElementIndex);
 			const void* ValueBuffer = MapHelper.GetValuePtr(ElementIndex);
 
@@ -2346,6 +3308,21 @@ bool FTsuContext::ValuesToString(const TArray<v8::Local<v8::Value>>& Values, FSt
 	return true;
 }
 
+void FTsuContext::AppendArgsToString(const v8::FunctionCallbackInfo<v8::Value>& Info, int32 Begin, FString& OutResult)
+{
+	v8::Local<v8::Context> Context = GlobalContext.Get(FTsuIsolate::Get());
+
+	for (int32 Index = Begin; Index < Info.Length(); ++Index)
+	{
+		if (Index > Begin)
+			OutResult += TEXT(' ');
+
+		v8::Local<v8::String> String;
+		if (Info[Index]->ToString(Context).ToLocal(&String))
+			FTsuStringConv::Append(OutResult, String);
+	}
+}
+
 bool FTsuContext::EnsureV8(bool bCondition, const TCHAR* Expression)
 {
 	if (LIKELY(bCondition))
@@ -2406,6 +3383,24 @@ void FTsuContext::GetCallSite(
 	OutFunctionName = V8_TO_TCHAR(StackFrame->GetFunctionName());
 }
 
+FString FTsuContext::GetFunctionDisplayName(v8::Local<v8::Function> Function)
+{
+	FString Name = V8_TO_TCHAR(Function->GetDebugName().As<v8::String>());
+	if (Name.IsEmpty())
+		Name = TEXT("(anonymous)");
+
+	v8::Local<v8::Value> ScriptName = Function->GetScriptOrigin().ResourceName();
+	if (ScriptName->IsString())
+	{
+		Name += FString::Printf(
+			TEXT(" (%s:%d)"),
+			*V8_TO_TCHAR(ScriptName.As<v8::String>()),
+			Function->GetScriptLineNumber() + 1);
+	}
+
+	return Name;
+}
+
 v8::Local<v8::Value> FTsuContext::UnwrapStructProxy(const v8::Local<v8::Value>& Value)
 {
 	if (!Value->IsProxy())
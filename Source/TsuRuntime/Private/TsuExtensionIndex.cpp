@@ -0,0 +1,270 @@
+#include "TsuExtensionIndex.h"
+
+#include "TsuBlueprintGeneratedClass.h"
+#include "TsuReflection.h"
+
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/UObjectIterator.h"
+
+namespace TsuExtensionIndex_Private
+{
+
+bool IsIndexableLibrary(UClass* Library)
+{
+	return (
+		Library->IsChildOf<UBlueprintFunctionLibrary>() &&
+		!Cast<UTsuBlueprintGeneratedClass>(Library) &&
+		FTsuReflection::IsValidClass(Library)
+	);
+}
+
+void RemoveFunctionsOf(FTsuExtensionIndex::FFunctionMap& Map, UClass* Library)
+{
+	for (auto It = Map.CreateIterator(); It; ++It)
+	{
+		It->Value.RemoveAll([&](UFunction* Function)
+		{
+			return Function->GetOuter() == Library;
+		});
+
+		if (It->Value.Num() == 0)
+			It.RemoveCurrent();
+	}
+}
+
+void RemoveFunctionsOf(FTsuExtensionIndex::FStructFunctionMap& Map, UClass* Library)
+{
+	for (auto It = Map.CreateIterator(); It; ++It)
+	{
+		if (It->Value->GetOuter() == Library)
+			It.RemoveCurrent();
+	}
+}
+
+} // namespace TsuExtensionIndex_Private
+
+FTsuExtensionIndex& FTsuExtensionIndex::GetUnbuilt()
+{
+	static FTsuExtensionIndex Index;
+	return Index;
+}
+
+FTsuExtensionIndex& FTsuExtensionIndex::Get()
+{
+	FTsuExtensionIndex& Index = GetUnbuilt();
+
+	// Building the index can find its way back here, which should just see the partially built index
+	if (!Index.bIsBuilt)
+	{
+		Index.bIsBuilt = true;
+		Index.Build();
+	}
+
+	return Index;
+}
+
+void FTsuExtensionIndex::AddDelegates()
+{
+	FTsuExtensionIndex& Index = GetUnbuilt();
+
+	if (!Index.HandleModulesChanged.IsValid())
+		Index.HandleModulesChanged = FModuleManager::Get().OnModulesChanged().AddRaw(&Index, &FTsuExtensionIndex::OnModulesChanged);
+
+#if WITH_EDITOR
+	if (GEditor && !Index.HandleBlueprintCompiled.IsValid())
+	{
+		Index.HandleBlueprintPreCompile = GEditor->OnBlueprintPreCompile().AddRaw(&Index, &FTsuExtensionIndex::OnBlueprintPreCompile);
+		Index.HandleBlueprintCompiled = GEditor->OnBlueprintCompiled().AddRaw(&Index, &FTsuExtensionIndex::OnBlueprintCompiled);
+	}
+#endif // WITH_EDITOR
+}
+
+void FTsuExtensionIndex::RemoveDelegates()
+{
+	FTsuExtensionIndex& Index = GetUnbuilt();
+
+	FModuleManager::Get().OnModulesChanged().Remove(Index.HandleModulesChanged);
+	Index.HandleModulesChanged.Reset();
+
+#if WITH_EDITOR
+	if (GEditor)
+	{
+		GEditor->OnBlueprintPreCompile().Remove(Index.HandleBlueprintPreCompile);
+		GEditor->OnBlueprintCompiled().Remove(Index.HandleBlueprintCompiled);
+	}
+#endif // WITH_EDITOR
+
+	Index.HandleBlueprintPreCompile.Reset();
+	Index.HandleBlueprintCompiled.Reset();
+	Index.CompilingBlueprints.Reset();
+}
+
+void FTsuExtensionIndex::Build()
+{
+	using namespace TsuExtensionIndex_Private;
+
+	Libraries.Reserve(512);
+
+	for (auto Class : TObjectRange<UClass>())
+	{
+		if (IsIndexableLibrary(Class))
+			AddLibrary(Class);
+	}
+
+	ResolvePendingFunctions();
+}
+
+void FTsuExtensionIndex::AddLibrary(UClass* Library)
+{
+	Libraries.Add(Library);
+
+	for (auto Function : TImmediateFieldRange<UFunction>(Library))
+	{
+		if (Function->HasMetaData(FTsuReflection::MetaNativeMakeFunc))
+		{
+			auto StructProperty = Cast<UStructProperty>(Function->GetReturnProperty());
+			if (ensure(StructProperty))
+				MakeFunctions.Add(StructProperty->Struct, Function);
+		}
+
+		if (Function->HasMetaData(FTsuReflection::MetaNativeBreakFunc))
+		{
+			FParamIterator ParamIt{Function};
+			auto StructProperty = ParamIt ? Cast<UStructProperty>(*ParamIt) : nullptr;
+			if (ensure(StructProperty))
+				BreakFunctions.Add(StructProperty->Struct, Function);
+		}
+
+		if (UStruct* Type = FTsuReflection::FindExtendedTypeNonStatic(Function))
+		{
+			if (FTsuReflection::CanLibraryExtendType(Library, Type))
+				ExtensionMethods.FindOrAdd(Type).Add(Function);
+		}
+
+		if (Function->HasMetaData(FTsuReflection::MetaTsuStaticExtension) ||
+			Function->HasMetaData(FTsuReflection::MetaTsuConstant) ||
+			Function->HasMetaData(FTsuReflection::MetaScriptConstantHost))
+		{
+			PendingFunctions.Add(Function);
+		}
+	}
+}
+
+void FTsuExtensionIndex::RemoveLibrary(UClass* Library)
+{
+	using namespace TsuExtensionIndex_Private;
+
+	Libraries.RemoveSingleSwap(Library);
+
+	RemoveFunctionsOf(ExtensionMethods, Library);
+	RemoveFunctionsOf(StaticExtensionMethods, Library);
+	RemoveFunctionsOf(ExtensionConstants, Library);
+	RemoveFunctionsOf(MakeFunctions, Library);
+	RemoveFunctionsOf(BreakFunctions, Library);
+}
+
+void FTsuExtensionIndex::ResolvePendingFunctions()
+{
+	// Resolving a type can add more functions, so we can't just iterate over the array
+	while (PendingFunctions.Num() > 0)
+	{
+		UFunction* Function = PendingFunctions.Pop(false);
+		UClass* Library = Function->GetOuterUClass();
+
+		if (UStruct* Type = FTsuReflection::FindExtendedTypeStatic(Function))
+		{
+			if (FTsuReflection::CanLibraryExtendType(Library, Type))
+				StaticExtensionMethods.FindOrAdd(Type).Add(Function);
+		}
+
+		if (UStruct* Type = FTsuReflection::FindExtendedTypeConstant(Function))
+		{
+			if (FTsuReflection::CanLibraryExtendType(Library, Type))
+				ExtensionConstants.FindOrAdd(Type).Add(Function);
+		}
+	}
+}
+
+void FTsuExtensionIndex::RemoveInvalidLibraries()
+{
+	for (int32 Index = Libraries.Num() - 1; Index >= 0; --Index)
+	{
+		if (FTsuReflection::IsInvalidClass(Libraries[Index]))
+			RemoveLibrary(Libraries[Index]);
+	}
+}
+
+void FTsuExtensionIndex::OnModulesChanged(FName ModuleName, EModuleChangeReason Reason)
+{
+	using namespace TsuExtensionIndex_Private;
+
+	// Everything is on its way out anyway, or will be picked up once the index gets built
+	if (GIsRequestingExit || !bIsBuilt)
+		return;
+
+	UPackage* Package = FindPackage(nullptr, *(TEXT("/Script/") + ModuleName.ToString()));
+	if (!Package)
+		return;
+
+	TArray<UObject*> Objects;
+	GetObjectsWithOuter(Package, Objects, false);
+
+	if (Reason == EModuleChangeReason::ModuleUnloaded)
+	{
+		for (UObject* Object : Objects)
+		{
+			if (auto Class = Cast<UClass>(Object))
+			{
+				if (Libraries.Contains(Class))
+					RemoveLibrary(Class);
+			}
+		}
+	}
+	else if (Reason == EModuleChangeReason::ModuleLoaded)
+	{
+		// Hot reload replaces the classes of a module that's already loaded
+		RemoveInvalidLibraries();
+
+		for (UObject* Object : Objects)
+		{
+			auto Class = Cast<UClass>(Object);
+			if (Class && IsIndexableLibrary(Class) && !Libraries.Contains(Class))
+				AddLibrary(Class);
+		}
+
+		ResolvePendingFunctions();
+	}
+}
+
+void FTsuExtensionIndex::OnBlueprintPreCompile(UBlueprint* Blueprint)
+{
+	CompilingBlueprints.AddUnique(Blueprint);
+}
+
+void FTsuExtensionIndex::OnBlueprintCompiled()
+{
+	using namespace TsuExtensionIndex_Private;
+
+	TArray<TWeakObjectPtr<UBlueprint>> CompiledBlueprints = MoveTemp(CompilingBlueprints);
+	CompilingBlueprints.Reset();
+
+	if (!bIsBuilt)
+		return;
+
+	// Compiling replaces the generated class, which leaves the old one behind as an invalid library
+	RemoveInvalidLibraries();
+
+	for (const TWeakObjectPtr<UBlueprint>& Blueprint : CompiledBlueprints)
+	{
+		UClass* Class = Blueprint.IsValid() ? Blueprint->GeneratedClass : nullptr;
+		if (Class && IsIndexableLibrary(Class) && !Libraries.Contains(Class))
+			AddLibrary(Class);
+	}
+
+	ResolvePendingFunctions();
+}
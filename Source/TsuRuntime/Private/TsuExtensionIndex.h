@@ -0,0 +1,86 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Modules/ModuleManager.h"
+
+class UBlueprint;
+
+/**
+ * All the function libraries, along with what they extend, indexed by type. It's built in a single
+ * pass over the function libraries the first time it's needed, and is then kept up to date as
+ * modules are loaded/unloaded and as blueprints get compiled.
+ */
+class FTsuExtensionIndex
+{
+public:
+	using FFunctionMap = TMap<UStruct*, TArray<UFunction*>>;
+	using FStructFunctionMap = TMap<UScriptStruct*, UFunction*>;
+
+	/** Gets the index, building it if needed */
+	static FTsuExtensionIndex& Get();
+
+	/**
+	 * Starts keeping the index up to date. Safe to call more than once, and has to be called again once
+	 * GEditor exists for blueprint compiles to be picked up.
+	 */
+	static void AddDelegates();
+
+	/** Stops keeping the index up to date, which has to happen before the module is unloaded */
+	static void RemoveDelegates();
+
+	const TArray<UClass*>& GetLibraries() const { return Libraries; }
+	const FStructFunctionMap& GetMakeFunctions() const { return MakeFunctions; }
+	const FStructFunctionMap& GetBreakFunctions() const { return BreakFunctions; }
+
+	const TArray<UFunction*>* FindExtensionMethods(UStruct* Type) const { return ExtensionMethods.Find(Type); }
+	const TArray<UFunction*>* FindStaticExtensionMethods(UStruct* Type) const { return StaticExtensionMethods.Find(Type); }
+	const TArray<UFunction*>* FindExtensionConstants(UStruct* Type) const { return ExtensionConstants.Find(Type); }
+
+private:
+	FTsuExtensionIndex() = default;
+
+	/** Gets the index without building it */
+	static FTsuExtensionIndex& GetUnbuilt();
+
+	/** Indexes every function library that's currently loaded */
+	void Build();
+
+	/** Indexes the non-static extensions and make/break functions of a library, deferring the rest */
+	void AddLibrary(UClass* Library);
+
+	/** Removes a library, along with everything it extends, from the index */
+	void RemoveLibrary(UClass* Library);
+
+	/**
+	 * Indexes the static extensions and constants that were deferred by AddLibrary. These name their
+	 * type in metadata, and looking that up can end up needing the non-static extensions of other
+	 * libraries, so they have to wait until all libraries have been added.
+	 */
+	void ResolvePendingFunctions();
+
+	/** Drops libraries that have since been replaced, either through hot reload or recompilation */
+	void RemoveInvalidLibraries();
+
+	void OnModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+	void OnBlueprintPreCompile(UBlueprint* Blueprint);
+	void OnBlueprintCompiled();
+
+	bool bIsBuilt = false;
+
+	FDelegateHandle HandleModulesChanged;
+	FDelegateHandle HandleBlueprintPreCompile;
+	FDelegateHandle HandleBlueprintCompiled;
+
+	/** Blueprints that have started compiling since the last time compiles finished */
+	TArray<TWeakObjectPtr<UBlueprint>> CompilingBlueprints;
+
+	TArray<UClass*> Libraries;
+	FFunctionMap ExtensionMethods;
+	FFunctionMap StaticExtensionMethods;
+	FFunctionMap ExtensionConstants;
+	FStructFunctionMap MakeFunctions;
+	FStructFunctionMap BreakFunctions;
+
+	TArray<UFunction*> PendingFunctions;
+};
@@ -1,15 +1,23 @@
 #include "TsuHeapStats.h"
 
+#include "TsuV8Allocator.h"
+
+#include "Misc/OutputDevice.h"
 #include "Stats/Stats.h"
 
 DECLARE_MEMORY_STAT(TEXT("V8 (Total Heap Size)"), STAT_V8MemoryTotalHeapSize, STATGROUP_Memory);
 DECLARE_MEMORY_STAT(TEXT("V8 (Used Heap Size)"), STAT_V8MemoryUsedHeapSize, STATGROUP_Memory);
 DECLARE_MEMORY_STAT(TEXT("V8 (Malloc Memory)"), STAT_V8MemoryMallocMemory, STATGROUP_Memory);
 DECLARE_MEMORY_STAT(TEXT("V8 (Peak Malloc Memory)"), STAT_V8MemoryPeakMallocMemory, STATGROUP_Memory);
+DECLARE_MEMORY_STAT(TEXT("V8 (ArrayBuffer Live)"), STAT_V8MemoryArrayBufferLive, STATGROUP_Memory);
+DECLARE_MEMORY_STAT(TEXT("V8 (ArrayBuffer Peak)"), STAT_V8MemoryArrayBufferPeak, STATGROUP_Memory);
+DECLARE_MEMORY_STAT(TEXT("V8 (ArrayBuffer Pooled)"), STAT_V8MemoryArrayBufferPooled, STATGROUP_Memory);
+DECLARE_MEMORY_STAT(TEXT("V8 (ArrayBuffer Large)"), STAT_V8MemoryArrayBufferLarge, STATGROUP_Memory);
 
-FTsuHeapStats::FTsuHeapStats(v8::Isolate* InIsolate)
+FTsuHeapStats::FTsuHeapStats(v8::Isolate* InIsolate, FTsuV8Allocator* InAllocator)
 	: FTickerObjectBase(1.f)
 	, Isolate(InIsolate)
+	, Allocator(InAllocator)
 {
 }
 
@@ -23,5 +31,35 @@ bool FTsuHeapStats::Tick(float DeltaTime)
 	SET_MEMORY_STAT(STAT_V8MemoryMallocMemory, HeapStatistics.malloced_memory());
 	SET_MEMORY_STAT(STAT_V8MemoryPeakMallocMemory, HeapStatistics.peak_malloced_memory());
 
+	const FTsuV8Allocator::FStats AllocatorStats = Allocator->GetStats();
+
+	SET_MEMORY_STAT(STAT_V8MemoryArrayBufferLive, AllocatorStats.LiveBytes);
+	SET_MEMORY_STAT(STAT_V8MemoryArrayBufferPeak, AllocatorStats.PeakBytes);
+	SET_MEMORY_STAT(STAT_V8MemoryArrayBufferPooled, AllocatorStats.PooledBytes);
+	SET_MEMORY_STAT(STAT_V8MemoryArrayBufferLarge, AllocatorStats.LargeBytes);
+
 	return true;
 }
+
+void FTsuHeapStats::DumpArrayBufferStats(FOutputDevice& Ar) const
+{
+	const FTsuV8Allocator::FStats AllocatorStats = Allocator->GetStats();
+
+	Ar.Logf(TEXT("ArrayBuffers: %lld KiB live, %lld KiB peak, %lld KiB pooled"),
+		AllocatorStats.LiveBytes / 1024,
+		AllocatorStats.PeakBytes / 1024,
+		AllocatorStats.PooledBytes / 1024);
+
+	Ar.Logf(TEXT("  %10s %12s %8s %8s"), TEXT("Bucket"), TEXT("Allocations"), TEXT("Live"), TEXT("Pooled"));
+
+	for (const FTsuV8Allocator::FBucketStats& BucketStats : AllocatorStats.Buckets)
+	{
+		Ar.Logf(TEXT("  %10llu %12lld %8lld %8lld"),
+			(uint64)BucketStats.BucketSize,
+			BucketStats.NumAllocations,
+			BucketStats.NumLive,
+			BucketStats.NumPooled);
+	}
+
+	Ar.Logf(TEXT("  %10s %12s %8lld %8s"), TEXT("Large"), TEXT("-"), AllocatorStats.NumLarge, TEXT("-"));
+}
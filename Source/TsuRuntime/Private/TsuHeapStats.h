@@ -6,14 +6,21 @@
 
 #include "Containers/Ticker.h"
 
+class FOutputDevice;
+class FTsuV8Allocator;
+
 class FTsuHeapStats
 	: public FTickerObjectBase
 {
 public:
-	FTsuHeapStats(v8::Isolate* InIsolate);
+	FTsuHeapStats(v8::Isolate* InIsolate, FTsuV8Allocator* InAllocator);
 
 	bool Tick(float DeltaTime) override;
 
+	/** Prints the ArrayBuffer usage of each allocator bucket */
+	void DumpArrayBufferStats(FOutputDevice& Ar) const;
+
 private:
 	v8::Isolate* Isolate = nullptr;
+	FTsuV8Allocator* Allocator = nullptr;
 };
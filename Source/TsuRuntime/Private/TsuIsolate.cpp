@@ -1,10 +1,23 @@
 #include "TsuIsolate.h"
 
 #include "TsuHeapStats.h"
+#include "TsuProfiler.h"
 #include "TsuRuntimeLog.h"
+#include "TsuRuntimeSettings.h"
+#include "TsuTryCatch.h"
+#include "TsuV8Allocator.h"
+
+#include "HAL/PlatformTime.h"
+#include "Misc/CoreDelegates.h"
 
 v8::Isolate* FTsuIsolate::Isolate = nullptr;
 std::unique_ptr<v8::Platform> FTsuIsolate::Platform;
+double FTsuIsolate::FrameStartTime = 0.0;
+bool FTsuIsolate::bIsUnderMemoryPressure = false;
+bool FTsuIsolate::bIsNearHeapLimit = false;
+FDelegateHandle FTsuIsolate::HandleBeginFrame;
+FDelegateHandle FTsuIsolate::HandleEndFrame;
+FDelegateHandle FTsuIsolate::HandleMemoryTrim;
 
 static void v8_error_handler(const char* Location, const char* Message)
 {
@@ -15,52 +28,157 @@ static void v8_error_handler(const char* Location, const char* Message)
 		UTF8_TO_TCHAR(Message));
 }
 
-class FTsuV8Allocator
-	: public v8::ArrayBuffer::Allocator
-{
-public:
-	~FTsuV8Allocator()
-	{
-	}
-
-    void* Allocate(size_t length) override
-	{
-		auto Ret = FMemory::Malloc(length, sizeof(void*));
-		if (!Ret) return Ret;
-		FMemory::Memzero(Ret, length);
-		return Ret;
-	}
-
-    void* AllocateUninitialized(size_t length) override
-	{
-		return FMemory::Malloc(length, sizeof(void*));
-	}
-
-    void Free(void* data, size_t length) override
-	{
-		return FMemory::Free(data);
-	}
-};
-
 static FTsuV8Allocator TsuV8Allocator;
+static TUniquePtr<FTsuHeapStats> TsuHeapStats;
 static v8::Local<v8::Context> TsuV8Context;
 
 void FTsuIsolate::Initialize()
 {
 	v8::V8::InitializeICUDefaultLocation("TSU");
 	v8::V8::InitializeExternalStartupData("TSU");
-	Platform = v8::platform::NewDefaultPlatform();
+	Platform = v8::platform::NewDefaultPlatform(0, v8::platform::IdleTaskSupport::kEnabled);
 	v8::V8::InitializePlatform(Platform.get());
 	v8::V8::Initialize();
 	v8::Isolate::CreateParams TsuV8CreateParams;
 	TsuV8CreateParams.array_buffer_allocator = &TsuV8Allocator;
+	ConfigureHeap(TsuV8CreateParams.constraints);
 	Isolate = v8::Isolate::New(TsuV8CreateParams);
 	Isolate->SetFatalErrorHandler(v8_error_handler);
+	Isolate->AddNearHeapLimitCallback(&FTsuIsolate::OnNearHeapLimit, nullptr);
+	Isolate->AutomaticallyRestoreInitialHeapLimit();
+
+	TsuHeapStats = MakeUnique<FTsuHeapStats>(Isolate, &TsuV8Allocator);
+
+	HandleBeginFrame = FCoreDelegates::OnBeginFrame.AddStatic(&FTsuIsolate::OnBeginFrame);
+	HandleEndFrame = FCoreDelegates::OnEndFrame.AddStatic(&FTsuIsolate::OnEndFrame);
+	HandleMemoryTrim = FCoreDelegates::GetMemoryTrimDelegate().AddStatic(&FTsuIsolate::OnMemoryTrim);
 }
 
 void FTsuIsolate::Uninitialize()
 {
+	FCoreDelegates::GetMemoryTrimDelegate().Remove(HandleMemoryTrim);
+	FCoreDelegates::OnEndFrame.Remove(HandleEndFrame);
+	FCoreDelegates::OnBeginFrame.Remove(HandleBeginFrame);
+
+	TsuHeapStats.Reset();
+	FTsuProfiler::Shutdown();
+
+	Isolate->RemoveNearHeapLimitCallback(&FTsuIsolate::OnNearHeapLimit, 0);
 	Isolate->Dispose();
 	v8::V8::Dispose();
 	v8::V8::ShutdownPlatform();
 }
+
+const FTsuHeapStats* FTsuIsolate::GetHeapStats()
+{
+	return TsuHeapStats.Get();
+}
+
+void FTsuIsolate::ConfigureHeap(v8::ResourceConstraints& Constraints)
+{
+	auto Settings = GetDefault<UTsuRuntimeSettings>();
+
+	const size_t InitialHeapSize = (size_t)Settings->InitialHeapSizeMB * 1024 * 1024;
+	const size_t MaxHeapSize = (size_t)Settings->MaxHeapSizeMB * 1024 * 1024;
+	const size_t MaxYoungGenerationSize = (size_t)Settings->MaxYoungGenerationSizeMB * 1024 * 1024;
+
+#if V8_MAJOR_VERSION >= 8
+	if (MaxHeapSize > 0)
+		Constraints.ConfigureDefaultsFromHeapSize(FMath::Min(InitialHeapSize, MaxHeapSize), MaxHeapSize);
+	else if (InitialHeapSize > 0)
+		Constraints.set_initial_old_generation_size_in_bytes(InitialHeapSize);
+
+	if (MaxYoungGenerationSize > 0)
+		Constraints.set_max_young_generation_size_in_bytes(MaxYoungGenerationSize);
+#else // V8_MAJOR_VERSION >= 8
+	if (MaxHeapSize > 0)
+		Constraints.set_max_old_space_size(Settings->MaxHeapSizeMB);
+
+	// The young generation is made up of two semi-spaces and the new large object space
+	if (MaxYoungGenerationSize > 0)
+		Constraints.set_max_semi_space_size_in_kb(MaxYoungGenerationSize / 1024 / 3);
+
+	if (InitialHeapSize > 0)
+		UE_LOG(LogTsuRuntime, Warning, TEXT("Initial heap size is not supported by this version of V8"));
+#endif // V8_MAJOR_VERSION >= 8
+}
+
+void FTsuIsolate::OnBeginFrame()
+{
+	FrameStartTime = FPlatformTime::Seconds();
+}
+
+void FTsuIsolate::OnEndFrame()
+{
+	auto Settings = GetDefault<UTsuRuntimeSettings>();
+
+	FTsuTryCatch::FlushSuppressedExceptions();
+
+	if (bIsNearHeapLimit)
+	{
+		// Deferred from OnNearHeapLimit, since it's not safe to force a GC from within one
+		Isolate->MemoryPressureNotification(v8::MemoryPressureLevel::kCritical);
+		bIsNearHeapLimit = false;
+	}
+
+	v8::HeapStatistics HeapStatistics;
+	Isolate->GetHeapStatistics(&HeapStatistics);
+
+	const double HeapUsage = (double)HeapStatistics.used_heap_size() / (double)HeapStatistics.heap_size_limit();
+	const bool bWasUnderMemoryPressure = bIsUnderMemoryPressure;
+	bIsUnderMemoryPressure = HeapUsage >= Settings->MemoryPressureThreshold;
+
+	if (bIsUnderMemoryPressure != bWasUnderMemoryPressure)
+	{
+		Isolate->MemoryPressureNotification(
+			bIsUnderMemoryPressure
+				? v8::MemoryPressureLevel::kModerate
+				: v8::MemoryPressureLevel::kNone);
+	}
+
+	if (!Settings->bIdleGarbageCollection)
+		return;
+
+	const double FrameTime = FPlatformTime::Seconds() - FrameStartTime;
+	const double IdleTime = Settings->IdleFrameBudgetMs / 1000.0 - FrameTime;
+	if (IdleTime < Settings->MinIdleTimeMs / 1000.0)
+		return;
+
+	const double Deadline = Platform->MonotonicallyIncreasingTime() + IdleTime;
+	Isolate->IdleNotificationDeadline(Deadline);
+
+	const double RemainingTime = Deadline - Platform->MonotonicallyIncreasingTime();
+	if (RemainingTime > 0.0)
+		v8::platform::RunIdleTasks(Platform.get(), Isolate, RemainingTime);
+}
+
+void FTsuIsolate::OnMemoryTrim()
+{
+	Isolate->MemoryPressureNotification(v8::MemoryPressureLevel::kCritical);
+	TsuV8Allocator.Trim();
+}
+
+size_t FTsuIsolate::OnNearHeapLimit(void* /*Data*/, size_t CurrentHeapLimit, size_t InitialHeapLimit)
+{
+	auto Settings = GetDefault<UTsuRuntimeSettings>();
+	const size_t Headroom = (size_t)Settings->NearHeapLimitHeadroomMB * 1024 * 1024;
+
+	if (CurrentHeapLimit > InitialHeapLimit)
+	{
+		// We've already given it some headroom, so whatever is running is most likely leaking
+		UE_LOG(LogTsuRuntime, Error, TEXT("V8 heap limit exceeded (%llu MB), terminating script execution"),
+			(uint64)(CurrentHeapLimit / 1024 / 1024));
+
+		Isolate->TerminateExecution();
+	}
+	else
+	{
+		UE_LOG(LogTsuRuntime, Warning, TEXT("V8 heap is near its limit (%llu MB), temporarily raising it by %d MB"),
+			(uint64)(CurrentHeapLimit / 1024 / 1024),
+			Settings->NearHeapLimitHeadroomMB);
+	}
+
+	bIsNearHeapLimit = true;
+
+	return CurrentHeapLimit + Headroom;
+}
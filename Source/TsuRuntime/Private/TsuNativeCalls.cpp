@@ -0,0 +1,312 @@
+#include "TsuNativeCalls.h"
+
+#include "TsuContext.h"
+#include "TsuRotatorLibrary.h"
+#include "TsuTransformLibrary.h"
+#include "TsuVectorLibrary.h"
+
+#include "Misc/DefaultValueHelper.h"
+#include "UObject/UnrealType.h"
+
+namespace TsuNativeCalls_Private
+{
+
+struct FNativeCall
+{
+	UClass* Library;
+	FName Name;
+	bool bIsExtension;
+	v8::FunctionCallback Callback;
+};
+
+#define TSU_NATIVE_METHOD(Library, Name) {Library::StaticClass(), GET_FUNCTION_NAME_CHECKED(Library, Name), true, TSU_NATIVE_CALL(true, Library::Name)}
+#define TSU_NATIVE_STATIC(Library, Name) {Library::StaticClass(), GET_FUNCTION_NAME_CHECKED(Library, Name), false, TSU_NATIVE_CALL(false, Library::Name)}
+
+/** Everything that takes and returns only numbers, booleans and the structs that TTsuNativeArg knows about */
+TArray<FNativeCall> GetNativeCalls()
+{
+	return {
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, Cross),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, Dot),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, Add),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, AddFloat),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, Subtract),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, SubtractFloat),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, Divide),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, DivideFloat),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, Multiply),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, MultiplyFloat),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, Equals),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, AllComponentsEqual),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, Negate),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, Component),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, GetMax),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, GetAbsMax),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, GetMin),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, GetAbsMin),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, ComponentMin),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, ComponentMax),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, GetAbs),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, Length),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, LengthSquared),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, Length2D),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, LengthSquared2D),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, IsNearlyZero),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, IsZero),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, IsNormalized),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, GetSignVector),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, Projection),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, GetUnsafeNormal),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, GridSnap),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, BoundToCube),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, GetClampedToLength),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, GetClampedToLength2D),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, GetClampedToMaxLength),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, GetClampedToMaxLength2D),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, AddBounded),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, Reciprocal),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, IsUniform),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, MirrorByVector),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, RotateAngleAxis),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, GetSafeNormal),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, GetSafeNormal2D),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, CosineAngle2D),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, ProjectOnTo),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, ProjectOnToNormal),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, ToRotator),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, ToQuat),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, UnwindEuler),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, ContainsNaN),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, IsUnit),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, UnitCartesianToSpherical),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, HeadingAngle),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, Dist),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, Dist2D),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, DistSquared),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, DistSquared2D),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, RadiansToDegrees),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, DegreesToRadians),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, Clone),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, Lerp),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, InterpTo),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, InterpToConstant),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, WithX),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, WithY),
+		TSU_NATIVE_METHOD(UTsuVectorLibrary, WithZ),
+		TSU_NATIVE_STATIC(UTsuVectorLibrary, PointsAreSame),
+		TSU_NATIVE_STATIC(UTsuVectorLibrary, PointsAreNear),
+		TSU_NATIVE_STATIC(UTsuVectorLibrary, PointPlaneDist),
+		TSU_NATIVE_STATIC(UTsuVectorLibrary, VectorPlaneProject),
+		TSU_NATIVE_STATIC(UTsuVectorLibrary, BoxPushOut),
+		TSU_NATIVE_STATIC(UTsuVectorLibrary, Parallel),
+		TSU_NATIVE_STATIC(UTsuVectorLibrary, Coincident),
+		TSU_NATIVE_STATIC(UTsuVectorLibrary, Orthogonal),
+		TSU_NATIVE_STATIC(UTsuVectorLibrary, Coplanar),
+		TSU_NATIVE_STATIC(UTsuVectorLibrary, Triple),
+
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, Add),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, AddFloats),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, Subtract),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, Scale),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, IsNearlyZero),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, IsZero),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, Equals),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, GetInverse),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, GridSnap),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, ToVector),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, ToQuaternion),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, ToEuler),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, RotateVector),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, UnrotateVector),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, Clamp),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, GetNormalized),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, GetDenormalized),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, ContainsNaN),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, GetForwardVector),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, GetRightVector),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, GetUpVector),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, Lerp),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, InterpTo),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, InterpToConstant),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, Compose),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, WithPitch),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, WithYaw),
+		TSU_NATIVE_METHOD(UTsuRotatorLibrary, WithRoll),
+		TSU_NATIVE_STATIC(UTsuRotatorLibrary, Random),
+		TSU_NATIVE_STATIC(UTsuRotatorLibrary, ClampAxis),
+		TSU_NATIVE_STATIC(UTsuRotatorLibrary, NormalizeAxis),
+		TSU_NATIVE_STATIC(UTsuRotatorLibrary, CompressAxisToByte),
+		TSU_NATIVE_STATIC(UTsuRotatorLibrary, DecompressAxisFromByte),
+		TSU_NATIVE_STATIC(UTsuRotatorLibrary, CompressAxisToShort),
+		TSU_NATIVE_STATIC(UTsuRotatorLibrary, DecompressAxisFromShort),
+		TSU_NATIVE_STATIC(UTsuRotatorLibrary, MakeFromEuler),
+
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, Inverse),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, BlendedWith),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, Multiply),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, ScaleLocation),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, ScaleLocationFloat),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, RemoveScaling),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, GetMaximumAxisScale),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, GetMinimumAxisScale),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, GetRelativeTransform),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, GetRelativeTransformReverse),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, TransformLocation),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, TransformLocationNoScale),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, InverseTransformLocation),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, InverseTransformLocationNoScale),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, TransformDirection),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, TransformDirectionNoScale),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, InverseTransformDirection),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, InverseTransformDirectionNoScale),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, TransformRotation),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, InverseTransformRotation),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, GetDeterminant),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, ContainsNaN),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, IsValid),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, RotationEquals),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, LocationEquals),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, ScaleEquals),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, Equals),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, EqualsNoScale),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, MultiplyScale),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, MultiplyScaleFloat),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, ConcatenateRotation),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, AddToLocation),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, Accumulate),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, NormalizeRotation),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, IsRotationNormalized),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, InterpTo),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, WithLocation),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, WithScale),
+		TSU_NATIVE_METHOD(UTsuTransformLibrary, WithRotation),
+		TSU_NATIVE_STATIC(UTsuTransformLibrary, AnyHasNegativeScale),
+		TSU_NATIVE_STATIC(UTsuTransformLibrary, GetSafeScaleReciprocal),
+		TSU_NATIVE_STATIC(UTsuTransformLibrary, AddTranslations),
+		TSU_NATIVE_STATIC(UTsuTransformLibrary, SubtractTranslations),
+	};
+}
+
+#undef TSU_NATIVE_METHOD
+#undef TSU_NATIVE_STATIC
+
+/** Parses the defaults of the trailing parameters that all have numeric or boolean defaults */
+FTsuNativeCalls::FDefaultArgs ParseDefaultArgs(UFunction* Function)
+{
+	FTsuNativeCalls::FDefaultArgs Result;
+
+	int32 NumParams = 0;
+	for (TFieldIterator<UProperty> It(Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+	{
+		if (It->HasAnyPropertyFlags(CPF_ReturnParm))
+			continue;
+
+		const int32 Index = NumParams++;
+		const FString MetaDefaultValue = TEXT("CPP_Default_") + It->GetName();
+		const FString& DefaultValue = Function->GetMetaData(*MetaDefaultValue);
+
+		double Value = 0.0;
+		bool bHasDefault = !DefaultValue.IsEmpty();
+		if (bHasDefault && It->IsA<UBoolProperty>())
+			Value = DefaultValue.ToBool() ? 1.0 : 0.0;
+		else if (bHasDefault && It->IsA<UNumericProperty>())
+			bHasDefault = FDefaultValueHelper::ParseDouble(DefaultValue, Value);
+		else
+			bHasDefault = false;
+
+		if (!bHasDefault)
+		{
+			Result.FirstIndex = Index + 1;
+			Result.Values.Reset();
+			continue;
+		}
+
+		Result.Values.Add(Value);
+	}
+
+	return Result;
+}
+
+struct FRegistry
+{
+	TMap<UFunction*, FNativeCall> Calls;
+	TMap<UFunction*, FTsuNativeCalls::FDefaultArgs> DefaultArgs;
+};
+
+const FRegistry& GetRegistry()
+{
+	static FRegistry Registry = []
+	{
+		FRegistry Result;
+
+		for (const FNativeCall& Call : GetNativeCalls())
+		{
+			if (UFunction* LibraryFunction = Call.Library->FindFunctionByName(Call.Name))
+			{
+				Result.Calls.Add(LibraryFunction, Call);
+
+				FTsuNativeCalls::FDefaultArgs DefaultArgs = ParseDefaultArgs(LibraryFunction);
+				if (DefaultArgs.Values.Num() > 0)
+					Result.DefaultArgs.Add(LibraryFunction, MoveTemp(DefaultArgs));
+			}
+		}
+
+		return Result;
+	}();
+
+	return Registry;
+}
+
+} // namespace TsuNativeCalls_Private
+
+v8::FunctionCallback FTsuNativeCalls::Find(UFunction* Function, bool bIsExtension)
+{
+	using namespace TsuNativeCalls_Private;
+
+	const FNativeCall* Call = GetRegistry().Calls.Find(Function);
+	return Call && Call->bIsExtension == bIsExtension ? Call->Callback : nullptr;
+}
+
+const FTsuNativeCalls::FDefaultArgs* FTsuNativeCalls::FindDefaultArgs(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+	using namespace TsuNativeCalls_Private;
+
+	if (!Info.Data()->IsExternal())
+		return nullptr;
+
+	auto Function = static_cast<UFunction*>(Info.Data().As<v8::External>()->Value());
+	return GetRegistry().DefaultArgs.Find(Function);
+}
+
+bool FTsuNativeCalls::ReadStruct(v8::Local<v8::Value> Value, UScriptStruct* Type, const void*& OutStruct)
+{
+	if (!Value->IsObject())
+		return false;
+
+	v8::Local<v8::Object> Object = FTsuContext::Singleton->UnwrapStructProxy(Value).As<v8::Object>();
+	if (Object->InternalFieldCount() != 2)
+		return false;
+
+	if (Object->GetAlignedPointerFromInternalField(1) != Type)
+		return false;
+
+	OutStruct = Object->GetAlignedPointerFromInternalField(0);
+	return OutStruct != nullptr;
+}
+
+v8::Local<v8::Value> FTsuNativeCalls::WrapStruct(const void* Struct, UScriptStruct* Type)
+{
+	void* Object = FMemory::Malloc(Type->GetStructureSize());
+	Type->InitializeStruct(Object);
+	Type->CopyScriptStruct(Object, Struct);
+
+	return FTsuContext::Singleton->ReferenceStructObject(Object, Type);
+}
+
+void FTsuNativeCalls::Fallback(const v8::FunctionCallbackInfo<v8::Value>& Info, bool bIsExtension)
+{
+	if (bIsExtension)
+		FTsuContext::_OnCallExtensionMethod(Info);
+	else
+		FTsuContext::_OnCallStaticMethod(Info);
+}
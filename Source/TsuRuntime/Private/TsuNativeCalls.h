@@ -0,0 +1,238 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "TsuRuntimeStats.h"
+#include "TsuV8Wrapper.h"
+
+#include "Templates/Decay.h"
+#include "Templates/EnableIf.h"
+#include "Templates/IntegerSequence.h"
+#include "Templates/IsArithmetic.h"
+#include "Templates/Tuple.h"
+#include "UObject/Class.h"
+
+/**
+ * Direct callbacks for the functions of the math libraries that only deal in numbers and plain structs. These
+ * convert their arguments straight from V8 and call the function itself, rather than going through a parameter
+ * buffer and ProcessEvent. Missing trailing arguments are filled in from the numeric and boolean defaults of
+ * the function, and calls with anything else unexpected are handed over to the regular callbacks.
+ */
+class FTsuNativeCalls
+{
+public:
+	/** The defaults of the trailing parameters of a library function, parsed from its metadata */
+	struct FDefaultArgs
+	{
+		/** The index of the first parameter with a default, counting `this` for extension methods */
+		int32 FirstIndex = 0;
+
+		/** The defaults from FirstIndex onwards, with booleans as 0 and 1 */
+		TArray<double> Values;
+	};
+
+	/**
+	 * Finds the direct callback for a library function, if it has one.
+	 *
+	 * @param Function The library function
+	 * @param bIsExtension Whether the function is called as a method, with `this` as the first parameter
+	 */
+	static v8::FunctionCallback Find(UFunction* Function, bool bIsExtension);
+
+	/** Finds the defaults of the function that a direct callback was called for, if it has any */
+	static const FDefaultArgs* FindDefaultArgs(const v8::FunctionCallbackInfo<v8::Value>& Info);
+
+	/** Gets the struct wrapped by a V8 object, provided that it's of the expected type */
+	static bool ReadStruct(v8::Local<v8::Value> Value, UScriptStruct* Type, const void*& OutStruct);
+
+	/** Wraps a copy of a struct in a V8 object */
+	static v8::Local<v8::Value> WrapStruct(const void* Struct, UScriptStruct* Type);
+
+	/** Calls the function through the regular callbacks instead */
+	static void Fallback(const v8::FunctionCallbackInfo<v8::Value>& Info, bool bIsExtension);
+};
+
+template<typename T, typename = void>
+struct TTsuNativeArg
+{
+	using FStorage = const T*;
+
+	static bool Read(v8::Local<v8::Value> Value, FStorage& Out)
+	{
+		const void* Struct = nullptr;
+		if (!FTsuNativeCalls::ReadStruct(Value, TBaseStructure<T>::Get(), Struct))
+			return false;
+
+		Out = static_cast<const T*>(Struct);
+		return true;
+	}
+
+	static bool ReadDefault(double /*Value*/, FStorage& /*Out*/)
+	{
+		return false;
+	}
+
+	static const T& Get(FStorage Storage)
+	{
+		return *Storage;
+	}
+};
+
+template<typename T>
+struct TTsuNativeArg<T, typename TEnableIf<TIsArithmetic<T>::Value>::Type>
+{
+	using FStorage = T;
+
+	static bool Read(v8::Local<v8::Value> Value, FStorage& Out)
+	{
+		if (!Value->IsNumber())
+			return false;
+
+		Out = (T)Value.As<v8::Number>()->Value();
+		return true;
+	}
+
+	static bool ReadDefault(double Value, FStorage& Out)
+	{
+		Out = (T)Value;
+		return true;
+	}
+
+	static T Get(FStorage Storage)
+	{
+		return Storage;
+	}
+};
+
+template<>
+struct TTsuNativeArg<bool>
+{
+	using FStorage = bool;
+
+	static bool Read(v8::Local<v8::Value> Value, FStorage& Out)
+	{
+		if (!Value->IsBoolean())
+			return false;
+
+		Out = Value.As<v8::Boolean>()->Value();
+		return true;
+	}
+
+	static bool ReadDefault(double Value, FStorage& Out)
+	{
+		Out = Value != 0.0;
+		return true;
+	}
+
+	static bool Get(FStorage Storage)
+	{
+		return Storage;
+	}
+};
+
+template<typename T, typename = void>
+struct TTsuNativeReturn
+{
+	static void Set(const v8::FunctionCallbackInfo<v8::Value>& Info, const T& Value)
+	{
+		Info.GetReturnValue().Set(FTsuNativeCalls::WrapStruct(&Value, TBaseStructure<T>::Get()));
+	}
+};
+
+template<typename T>
+struct TTsuNativeReturn<T, typename TEnableIf<TIsArithmetic<T>::Value>::Type>
+{
+	static void Set(const v8::FunctionCallbackInfo<v8::Value>& Info, T Value)
+	{
+		Info.GetReturnValue().Set((double)Value);
+	}
+};
+
+template<>
+struct TTsuNativeReturn<bool>
+{
+	static void Set(const v8::FunctionCallbackInfo<v8::Value>& Info, bool Value)
+	{
+		Info.GetReturnValue().Set(Value);
+	}
+};
+
+template<bool bIsExtension, typename FunctionType, FunctionType Function>
+struct TTsuNativeCall;
+
+template<bool bIsExtension, typename ReturnType, typename... ArgTypes, ReturnType(*Function)(ArgTypes...)>
+struct TTsuNativeCall<bIsExtension, ReturnType(*)(ArgTypes...), Function>
+{
+	static void Call(const v8::FunctionCallbackInfo<v8::Value>& Info)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_TsuCallNative);
+
+		CallWithIndices(Info, TMakeIntegerSequence<uint32, sizeof...(ArgTypes)>());
+	}
+
+private:
+	template<uint32... Indices>
+	static void CallWithIndices(const v8::FunctionCallbackInfo<v8::Value>& Info, TIntegerSequence<uint32, Indices...>)
+	{
+		constexpr int32 NumArgs = (int32)sizeof...(ArgTypes) - (bIsExtension ? 1 : 0);
+
+		const FTsuNativeCalls::FDefaultArgs* Defaults = nullptr;
+		if (Info.Length() < NumArgs)
+		{
+			Defaults = FTsuNativeCalls::FindDefaultArgs(Info);
+			if (Defaults == nullptr || Info.Length() + (bIsExtension ? 1 : 0) < Defaults->FirstIndex)
+			{
+				FTsuNativeCalls::Fallback(Info, bIsExtension);
+				return;
+			}
+		}
+
+		TTuple<typename TTsuNativeArg<typename TDecay<ArgTypes>::Type>::FStorage...> Args;
+
+		bool bReadAll = true;
+		bool Results[] = {
+			true,
+			(bReadAll = bReadAll && ReadArg<typename TDecay<ArgTypes>::Type>(
+				Info,
+				Indices,
+				Defaults,
+				Args.template Get<Indices>()))...
+		};
+
+		(void)Results;
+
+		if (!bReadAll)
+		{
+			FTsuNativeCalls::Fallback(Info, bIsExtension);
+			return;
+		}
+
+		TTsuNativeReturn<typename TDecay<ReturnType>::Type>::Set(
+			Info,
+			Function(TTsuNativeArg<typename TDecay<ArgTypes>::Type>::Get(Args.template Get<Indices>())...));
+	}
+
+	template<typename T>
+	static bool ReadArg(
+		const v8::FunctionCallbackInfo<v8::Value>& Info,
+		uint32 Index,
+		const FTsuNativeCalls::FDefaultArgs* Defaults,
+		typename TTsuNativeArg<T>::FStorage& Out)
+	{
+		// Only trailing arguments are ever missing, which CallWithIndices has made sure have defaults
+		if ((int32)Index < Info.Length() + (bIsExtension ? 1 : 0))
+			return TTsuNativeArg<T>::Read(GetArg(Info, Index), Out);
+		else
+			return TTsuNativeArg<T>::ReadDefault(Defaults->Values[(int32)Index - Defaults->FirstIndex], Out);
+	}
+
+	static v8::Local<v8::Value> GetArg(const v8::FunctionCallbackInfo<v8::Value>& Info, uint32 Index)
+	{
+		if (bIsExtension)
+			return Index == 0 ? v8::Local<v8::Value>(Info.This()) : Info[Index - 1];
+		else
+			return Info[Index];
+	}
+};
+
+#define TSU_NATIVE_CALL(bIsExtension, Function) &TTsuNativeCall<bIsExtension, decltype(&Function), &Function>::Call
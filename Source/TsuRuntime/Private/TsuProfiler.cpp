@@ -0,0 +1,465 @@
+#include "TsuProfiler.h"
+
+#include "TsuContext.h"
+#include "TsuIsolate.h"
+#include "TsuRuntimeLog.h"
+#include "TsuStringConv.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/OutputDeviceFile.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+namespace TsuProfiler_Private
+{
+
+using FJsonWriter = TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>;
+using FJsonWriterFactory = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>;
+
+const TCHAR* ProfileTitle = TEXT("TSU");
+
+void WriteNode(FJsonWriter& Writer, const v8::CpuProfileNode& Node)
+{
+	Writer.WriteObjectStart();
+	Writer.WriteValue(TEXT("id"), (int64)Node.GetNodeId());
+
+	Writer.WriteObjectStart(TEXT("callFrame"));
+	Writer.WriteValue(TEXT("functionName"), UTF8_TO_TCHAR(Node.GetFunctionNameStr()));
+	Writer.WriteValue(TEXT("scriptId"), FString::FromInt(Node.GetScriptId()));
+	Writer.WriteValue(TEXT("url"), UTF8_TO_TCHAR(Node.GetScriptResourceNameStr()));
+	// DevTools expects zero-based positions, V8 hands out one-based ones
+	Writer.WriteValue(TEXT("lineNumber"), Node.GetLineNumber() - 1);
+	Writer.WriteValue(TEXT("columnNumber"), Node.GetColumnNumber() - 1);
+	Writer.WriteObjectEnd();
+
+	Writer.WriteValue(TEXT("hitCount"), (int64)Node.GetHitCount());
+
+	const int32 NumChildren = Node.GetChildrenCount();
+	if (NumChildren > 0)
+	{
+		Writer.WriteArrayStart(TEXT("children"));
+
+		for (int32 ChildIndex = 0; ChildIndex < NumChildren; ++ChildIndex)
+			Writer.WriteValue((int64)Node.GetChild(ChildIndex)->GetNodeId());
+
+		Writer.WriteArrayEnd();
+	}
+
+	Writer.WriteObjectEnd();
+
+	for (int32 ChildIndex = 0; ChildIndex < NumChildren; ++ChildIndex)
+		WriteNode(Writer, *Node.GetChild(ChildIndex));
+}
+
+class FArchiveOutputStream final
+	: public v8::OutputStream
+{
+public:
+	explicit FArchiveOutputStream(FArchive& InArchive)
+		: Archive(InArchive)
+	{
+	}
+
+	int GetChunkSize() override
+	{
+		return 64 * 1024;
+	}
+
+	WriteResult WriteAsciiChunk(char* Data, int Size) override
+	{
+		Archive.Serialize(Data, Size);
+		return Archive.IsError() ? kAbort : kContinue;
+	}
+
+	void EndOfStream() override
+	{
+	}
+
+private:
+	FArchive& Archive;
+};
+
+/** Answers which module, if any, ends up retaining a given node in a heap snapshot */
+class FRetainerGraph
+{
+public:
+	explicit FRetainerGraph(const v8::HeapSnapshot& InSnapshot)
+		: Snapshot(InSnapshot)
+	{
+		const int32 NumNodes = Snapshot.GetNodesCount();
+
+		NodeIndices.Reserve(NumNodes);
+		for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+			NodeIndices.Add(Snapshot.GetNode(NodeIndex), NodeIndex);
+
+		NodeModules.Init(INDEX_NONE, NumNodes);
+	}
+
+	void AddModule(const v8::HeapGraphNode* Node, const FString& ModulePath)
+	{
+		const int32* NodeIndex = NodeIndices.Find(Node);
+		if (!NodeIndex || NodeModules[*NodeIndex] != INDEX_NONE)
+			return;
+
+		NodeModules[*NodeIndex] = ModulePaths.Add(ModulePath);
+		Queue.Add(*NodeIndex);
+	}
+
+	/**
+	 * Labels every node reachable from the added modules with the module closest to it, in a single
+	 * breadth-first search from all of the modules at once, so that lookups don't need to search at all
+	 */
+	void LabelReachableNodes()
+	{
+		for (int32 QueueIndex = 0; QueueIndex < Queue.Num(); ++QueueIndex)
+		{
+			const int32 NodeIndex = Queue[QueueIndex];
+			const int32 ModuleIndex = NodeModules[NodeIndex];
+
+			const v8::HeapGraphNode* Node = Snapshot.GetNode(NodeIndex);
+			const int32 NumEdges = Node->GetChildrenCount();
+
+			for (int32 EdgeIndex = 0; EdgeIndex < NumEdges; ++EdgeIndex)
+			{
+				const v8::HeapGraphEdge* Edge = Node->GetChild(EdgeIndex);
+				if (Edge->GetType() == v8::HeapGraphEdge::kWeak)
+					continue;
+
+				const int32* ChildIndex = NodeIndices.Find(Edge->GetToNode());
+				if (ChildIndex && NodeModules[*ChildIndex] == INDEX_NONE)
+				{
+					NodeModules[*ChildIndex] = ModuleIndex;
+					Queue.Add(*ChildIndex);
+				}
+			}
+		}
+
+		Queue.Empty();
+	}
+
+	FString FindRetainingModule(const v8::HeapGraphNode* Node) const
+	{
+		const int32* NodeIndex = NodeIndices.Find(Node);
+		if (!NodeIndex || NodeModules[*NodeIndex] == INDEX_NONE)
+			return TEXT("(unknown)");
+
+		return ModulePaths[NodeModules[*NodeIndex]];
+	}
+
+private:
+	const v8::HeapSnapshot& Snapshot;
+	TMap<const v8::HeapGraphNode*, int32> NodeIndices;
+	TArray<int32> NodeModules;
+	TArray<FString> ModulePaths;
+	TArray<int32> Queue;
+};
+
+struct FWrapperGroup
+{
+	int32 NumWrappers = 0;
+	int32 NumSurvivors = 0;
+};
+
+} // namespace TsuProfiler_Private
+
+v8::CpuProfiler* FTsuProfiler::CpuProfiler = nullptr;
+
+bool FTsuProfiler::StartCpuProfiling(int32 SamplingIntervalUs)
+{
+	using namespace TsuProfiler_Private;
+
+	if (CpuProfiler)
+	{
+		UE_LOG(LogTsuRuntime, Warning, TEXT("A CPU profile is already being recorded"));
+		return false;
+	}
+
+	v8::Isolate* Isolate = FTsuIsolate::Get();
+	v8::HandleScope HandleScope{Isolate};
+
+	CpuProfiler = v8::CpuProfiler::New(Isolate);
+
+	if (SamplingIntervalUs > 0)
+		CpuProfiler->SetSamplingInterval(SamplingIntervalUs);
+
+	CpuProfiler->StartProfiling(TCHAR_TO_V8(ProfileTitle), /*record_samples=*/true);
+
+	UE_LOG(LogTsuRuntime, Log, TEXT("Started recording CPU profile"));
+
+	return true;
+}
+
+bool FTsuProfiler::StopCpuProfiling(const FString& FilePath)
+{
+	using namespace TsuProfiler_Private;
+
+	if (!CpuProfiler)
+	{
+		UE_LOG(LogTsuRuntime, Warning, TEXT("No CPU profile is being recorded"));
+		return false;
+	}
+
+	v8::Isolate* Isolate = FTsuIsolate::Get();
+	v8::HandleScope HandleScope{Isolate};
+
+	v8::CpuProfile* Profile = CpuProfiler->StopProfiling(TCHAR_TO_V8(ProfileTitle));
+
+	FString Json;
+	if (Profile)
+	{
+		WriteCpuProfile(*Profile, Json);
+		Profile->Delete();
+	}
+
+	CpuProfiler->Dispose();
+	CpuProfiler = nullptr;
+
+	if (!Profile)
+	{
+		UE_LOG(LogTsuRuntime, Error, TEXT("Failed to stop recording CPU profile"));
+		return false;
+	}
+
+	const FString OutputPath = ResolveOutputPath(FilePath, TEXT(".cpuprofile"));
+	if (!FFileHelper::SaveStringToFile(Json, *OutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogTsuRuntime, Error, TEXT("Failed to write CPU profile to '%s'"), *OutputPath);
+		return false;
+	}
+
+	UE_LOG(LogTsuRuntime, Log, TEXT("Wrote CPU profile to '%s'"), *OutputPath);
+
+	return true;
+}
+
+bool FTsuProfiler::TakeHeapSnapshot(const FString& FilePath, uint32 MinSurvivedGCs, FOutputDevice& Ar)
+{
+	using namespace TsuProfiler_Private;
+
+	v8::Isolate* Isolate = FTsuIsolate::Get();
+	v8::HandleScope HandleScope{Isolate};
+
+	v8::HeapProfiler* HeapProfiler = Isolate->GetHeapProfiler();
+	const v8::HeapSnapshot* Snapshot = HeapProfiler->TakeHeapSnapshot();
+	if (!Snapshot)
+	{
+		Ar.Logf(ELogVerbosity::Error, TEXT("Failed to take heap snapshot"));
+		return false;
+	}
+
+	ON_SCOPE_EXIT
+	{
+		const_cast<v8::HeapSnapshot*>(Snapshot)->Delete();
+	};
+
+	const FString OutputPath = ResolveOutputPath(FilePath, TEXT(".heapsnapshot"));
+
+	TUniquePtr<FArchive> Writer{IFileManager::Get().CreateFileWriter(*OutputPath)};
+	if (!Writer)
+	{
+		Ar.Logf(ELogVerbosity::Error, TEXT("Failed to open '%s' for writing"), *OutputPath);
+		return false;
+	}
+
+	FArchiveOutputStream Stream{*Writer};
+	Snapshot->Serialize(&Stream, v8::HeapSnapshot::kJSON);
+
+	if (!Writer->Close())
+	{
+		Ar.Logf(ELogVerbosity::Error, TEXT("Failed to write heap snapshot to '%s'"), *OutputPath);
+		return false;
+	}
+
+	Ar.Logf(TEXT("Wrote heap snapshot to '%s'"), *OutputPath);
+
+	if (FTsuContext::Exists())
+	{
+		const FString ReportPath = FPaths::ChangeExtension(OutputPath, TEXT(".txt"));
+
+		FOutputDeviceFile ReportFile{*ReportPath, /*bDisableBackup=*/true};
+		ReportFile.SetSuppressEventTag(true);
+		WriteWrapperReport(*Snapshot, MinSurvivedGCs, ReportFile);
+		ReportFile.TearDown();
+
+		Ar.Logf(TEXT("Wrote wrapper report to '%s'"), *ReportPath);
+	}
+
+	return true;
+}
+
+void FTsuProfiler::DumpPerformanceEntries(FOutputDevice& Ar)
+{
+	if (!FTsuContext::Exists())
+		return;
+
+	FTsuContext& Context = FTsuContext::Get();
+	const int32 NumEntries = Context.PerformanceEntries.Num();
+
+	Ar.Logf(TEXT("%12s %12s  %s"), TEXT("Start (ms)"), TEXT("Duration (ms)"), TEXT("Name"));
+
+	for (int32 Offset = 0; Offset < NumEntries; ++Offset)
+	{
+		const int32 EntryIndex = (Context.NextPerformanceEntry + Offset) % NumEntries;
+		const FTsuContext::FPerformanceEntry& Entry = Context.PerformanceEntries[EntryIndex];
+
+		if (Entry.bIsMeasure)
+			Ar.Logf(TEXT("%12.3f %12.3f  %s"), Entry.StartTime * 1000.0, Entry.Duration * 1000.0, *Entry.Name);
+		else
+			Ar.Logf(TEXT("%12.3f %12s  %s"), Entry.StartTime * 1000.0, TEXT("-"), *Entry.Name);
+	}
+}
+
+void FTsuProfiler::Shutdown()
+{
+	if (CpuProfiler)
+	{
+		CpuProfiler->Dispose();
+		CpuProfiler = nullptr;
+	}
+}
+
+FString FTsuProfiler::ResolveOutputPath(const FString& FilePath, const TCHAR* Extension)
+{
+	FString OutputPath = FPaths::IsRelative(FilePath)
+		? FPaths::Combine(FPaths::ProfilingDir(), TEXT("Tsu"), FilePath)
+		: FilePath;
+
+	if (!OutputPath.EndsWith(Extension))
+		OutputPath += Extension;
+
+	return FPaths::ConvertRelativePathToFull(OutputPath);
+}
+
+void FTsuProfiler::WriteCpuProfile(const v8::CpuProfile& Profile, FString& OutJson)
+{
+	using namespace TsuProfiler_Private;
+
+	TSharedRef<FJsonWriter> Writer = FJsonWriterFactory::Create(&OutJson);
+
+	Writer->WriteObjectStart();
+
+	Writer->WriteArrayStart(TEXT("nodes"));
+	WriteNode(*Writer, *Profile.GetTopDownRoot());
+	Writer->WriteArrayEnd();
+
+	const int64 StartTime = Profile.GetStartTime();
+	Writer->WriteValue(TEXT("startTime"), StartTime);
+	Writer->WriteValue(TEXT("endTime"), Profile.GetEndTime());
+
+	const int32 NumSamples = Profile.GetSamplesCount();
+
+	Writer->WriteArrayStart(TEXT("samples"));
+	for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+		Writer->WriteValue((int64)Profile.GetSample(SampleIndex)->GetNodeId());
+	Writer->WriteArrayEnd();
+
+	Writer->WriteArrayStart(TEXT("timeDeltas"));
+	int64 PreviousTime = StartTime;
+	for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+	{
+		const int64 SampleTime = Profile.GetSampleTimestamp(SampleIndex);
+		Writer->WriteValue(SampleTime - PreviousTime);
+		PreviousTime = SampleTime;
+	}
+	Writer->WriteArrayEnd();
+
+	Writer->WriteObjectEnd();
+	Writer->Close();
+}
+
+void FTsuProfiler::WriteWrapperReport(const v8::HeapSnapshot& Snapshot, uint32 MinSurvivedGCs, FOutputDevice& Ar)
+{
+	using namespace TsuProfiler_Private;
+
+	FTsuContext& Context = FTsuContext::Get();
+
+	v8::Isolate* Isolate = FTsuIsolate::Get();
+	v8::HeapProfiler* HeapProfiler = Isolate->GetHeapProfiler();
+
+	FRetainerGraph Graph{Snapshot};
+
+	for (auto& Module : Context.ModuleExports)
+	{
+		if (Module.Value.IsEmpty())
+			continue;
+
+		v8::Local<v8::Value> Exports = Module.Value.Get(Isolate);
+		Graph.AddModule(Snapshot.GetNodeById(HeapProfiler->GetObjectId(Exports)), Module.Key);
+	}
+
+	Graph.LabelReachableNodes();
+
+	using FGroupKey = TTuple<FString, FString>;
+
+	TMap<FGroupKey, FWrapperGroup> Groups;
+	TArray<FString> Survivors;
+
+	auto AddWrapper = [&](const v8::Global<v8::Object>& Wrapper, const void* Key, const FString& TypeName, const FString& Name)
+	{
+		const v8::HeapGraphNode* Node = Snapshot.GetNodeById(HeapProfiler->GetObjectId(Wrapper.Get(Isolate)));
+		const FString ModulePath = Node ? Graph.FindRetainingModule(Node) : TEXT("(unknown)");
+
+		FWrapperGroup& Group = Groups.FindOrAdd(FGroupKey{TypeName, ModulePath});
+		++Group.NumWrappers;
+
+		const uint32* Generation = Context.WrapperGenerations.Find(Key);
+		const uint32 NumSurvivedGCs = Generation ? Context.NumGarbageCollections - *Generation : 0;
+		if (NumSurvivedGCs >= MinSurvivedGCs)
+		{
+			++Group.NumSurvivors;
+			Survivors.Add(FString::Printf(TEXT("%s %s, survived %u GCs, retained by %s"), *TypeName, *Name, NumSurvivedGCs, *ModulePath));
+		}
+	};
+
+	for (auto& Object : Context.AliveObjects)
+		AddWrapper(Object.Value, Object.Key, Object.Key->GetClass()->GetName(), Object.Key->GetPathName());
+
+	for (auto& Struct : Context.AliveStructs)
+	{
+		const void* StructObject = Struct.Key.Key;
+		AddWrapper(Struct.Value, StructObject, Struct.Key.Value->GetName(), FString::Printf(TEXT("at %p"), StructObject));
+	}
+
+	for (auto& Delegate : Context.AliveDelegates)
+	{
+		UObject* Parent = Delegate.Key.Key;
+		UProperty* Property = Delegate.Key.Value;
+		AddWrapper(Delegate.Value, Property->ContainerPtrToValuePtr<void>(Parent), Property->GetClass()->GetName(), Parent->GetPathName() + TEXT(".") + Property->GetName());
+	}
+
+	Groups.ValueSort([](const FWrapperGroup& Lhs, const FWrapperGroup& Rhs)
+	{
+		return Lhs.NumWrappers > Rhs.NumWrappers;
+	});
+
+	Ar.Logf(TEXT("%d objects, %d structs and %d delegates are referenced from scripts (%u full GCs so far)"),
+		Context.AliveObjects.Num(),
+		Context.AliveStructs.Num(),
+		Context.AliveDelegates.Num(),
+		Context.NumGarbageCollections);
+
+	Ar.Logf(TEXT(""));
+	Ar.Logf(TEXT("%8s %9s  %-40s %s"), TEXT("Count"), TEXT("Survivors"), TEXT("Type"), TEXT("Retaining module"));
+
+	for (auto& Group : Groups)
+	{
+		Ar.Logf(TEXT("%8d %9d  %-40s %s"),
+			Group.Value.NumWrappers,
+			Group.Value.NumSurvivors,
+			*Group.Key.Get<0>(),
+			*Group.Key.Get<1>());
+	}
+
+	if (Survivors.Num() > 0)
+	{
+		Ar.Logf(TEXT(""));
+		Ar.Logf(TEXT("Wrappers that have survived at least %u full GCs:"), MinSurvivedGCs);
+
+		Survivors.Sort();
+		for (const FString& Survivor : Survivors)
+			Ar.Logf(TEXT("  %s"), *Survivor);
+	}
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "TsuV8Wrapper.h"
+
+class FOutputDevice;
+
+class FTsuProfiler
+{
+public:
+	/**
+	 * Starts sampling the call stacks of scripts.
+	 *
+	 * @param SamplingIntervalUs The time between samples, in microseconds (0 uses the V8 default)
+	 * @returns Whether profiling was started or not
+	 */
+	static bool StartCpuProfiling(int32 SamplingIntervalUs = 0);
+
+	/**
+	 * Stops sampling and writes the samples to a `.cpuprofile` file, which can be opened in Chrome DevTools or VS Code.
+	 *
+	 * @param FilePath Where to write the profile, relative to the profiling directory unless absolute
+	 * @returns Whether the profile was written or not
+	 */
+	static bool StopCpuProfiling(const FString& FilePath);
+
+	/** Returns whether a CPU profile is being recorded or not */
+	static bool IsCpuProfiling() { return CpuProfiler != nullptr; }
+
+	/**
+	 * Writes a `.heapsnapshot` file of the V8 heap, along with a report of which objects, structs and delegates are
+	 * being kept alive by scripts, grouped by type and the module retaining them.
+	 *
+	 * @param FilePath Where to write the snapshot, relative to the profiling directory unless absolute
+	 * @param MinSurvivedGCs How many full GCs a wrapper can survive before it's flagged as a potential leak
+	 * @param Ar Where to print the summary of the report
+	 * @returns Whether the snapshot was written or not
+	 */
+	static bool TakeHeapSnapshot(const FString& FilePath, uint32 MinSurvivedGCs, FOutputDevice& Ar);
+
+	/** Prints the marks and measures in the performance ring buffer, oldest first */
+	static void DumpPerformanceEntries(FOutputDevice& Ar);
+
+	/** Discards any ongoing recordings, ahead of the isolate being disposed */
+	static void Shutdown();
+
+	/** Resolves a user-supplied path against the profiling directory and makes sure it has the given extension */
+	static FString ResolveOutputPath(const FString& FilePath, const TCHAR* Extension);
+
+private:
+	static void WriteCpuProfile(const v8::CpuProfile& Profile, FString& OutJson);
+	static void WriteWrapperReport(const v8::HeapSnapshot& Snapshot, uint32 MinSurvivedGCs, FOutputDevice& Ar);
+
+	static v8::CpuProfiler* CpuProfiler;
+};
@@ -1,6 +1,6 @@
 #include "TsuReflection.h"
 
-#include "TsuBlueprintGeneratedClass.h"
+#include "TsuExtensionIndex.h"
 #include "TsuObjectLibrary.h"
 #include "TsuRotatorLibrary.h"
 #include "TsuTimelineLibrary.h"
@@ -9,7 +9,6 @@
 #include "TsuUtilities.h"
 #include "TsuVectorLibrary.h"
 
-#include "Kismet/BlueprintFunctionLibrary.h"
 #include "UObject/UObjectIterator.h"
 
 // #todo(#mihe): Take a look at UEdGraphSchema_K2::IsAllowableBlueprintVariableType?
@@ -258,89 +257,20 @@ void FTsuReflection::VisitAllTypes(const TypeVisitor& Visitor)
 
 void FTsuReflection::VisitFunctionLibraries(const LibraryVisitor& Visitor)
 {
-	using FCache = TArray<UClass*>;
-
-	static const FCache Cache = []
-	{
-		FCache Result;
-
-		for (auto Class : TObjectRange<UClass>())
-		{
-			if (!Class->IsChildOf<UBlueprintFunctionLibrary>())
-				continue;
-
-			if (Cast<UTsuBlueprintGeneratedClass>(Class))
-				continue;
-
-			Result.Add(Class);
-		}
-
-		return Result;
-	}();
-
-	for (UClass* Class : Cache)
+	for (UClass* Class : FTsuExtensionIndex::Get().GetLibraries())
 		Visitor(Class);
 }
 
 void FTsuReflection::VisitMakeFunctions(const MakeVisitor& Visitor)
 {
-	using FCache = TMap<UFunction*, UScriptStruct*>;
-
-	static const FCache Cache = []
-	{
-		FCache Result;
-
-		VisitFunctionLibraries([&](UClass* Library)
-		{
-			for (auto Function : TImmediateFieldRange<UFunction>(Library))
-			{
-				if (!Function->HasMetaData(MetaNativeMakeFunc))
-					continue;
-
-				UProperty* ReturnProperty = Function->GetReturnProperty();
-				auto StructProperty = Cast<UStructProperty>(ReturnProperty);
-				if (ensure(StructProperty))
-					Result.FindOrAdd(Function) = StructProperty->Struct;
-			}
-		});
-
-		return Result;
-	}();
-
-	for (const auto& Entry : Cache)
-		Visitor(Entry.Key, Entry.Value);
+	for (const auto& Entry : FTsuExtensionIndex::Get().GetMakeFunctions())
+		Visitor(Entry.Value, Entry.Key);
 }
 
 void FTsuReflection::VisitBreakFunctions(const BreakVisitor& Visitor)
 {
-	using FCache = TMap<UFunction*, UScriptStruct*>;
-
-	static const FCache Cache = []
-	{
-		FCache Result;
-
-		VisitFunctionLibraries([&](UClass* Library)
-		{
-			for (auto Function : TImmediateFieldRange<UFunction>(Library))
-			{
-				if (!Function->HasMetaData(MetaNativeBreakFunc))
-					continue;
-
-				FParamIterator ParamIt{Function};
-				if (!ensure(ParamIt))
-					continue;
-
-				auto StructProperty = Cast<UStructProperty>(*ParamIt);
-				if (ensure(StructProperty))
-					Result.FindOrAdd(Function) = StructProperty->Struct;
-			}
-		});
-
-		return Result;
-	}();
-
-	for (const auto& Entry : Cache)
-		Visitor(Entry.Key, Entry.Value);
+	for (const auto& Entry : FTsuExtensionIndex::Get().GetBreakFunctions())
+		Visitor(Entry.Value, Entry.Key);
 }
 
 void FTsuReflection::VisitProperties(
@@ -390,28 +320,7 @@ void FTsuReflection::VisitMethods(const MethodVisitor& Visitor, UStruct* Object)
 
 void FTsuReflection::VisitExtensionMethods(const ExtensionVisitor& Visitor, UStruct* Object)
 {
-	using FCache = TMap<UStruct*, TArray<UFunction*>>;
-
-	static const FCache Cache = [&]
-	{
-		FCache Result;
-
-		VisitFunctionLibraries([&](UClass* Library)
-		{
-			for (auto Function : TImmediateFieldRange<UFunction>(Library))
-			{
-				if (UStruct* Type = FindExtendedTypeNonStatic(Function))
-				{
-					if (CanLibraryExtendType(Library, Type))
-						Result.FindOrAdd(Type).Add(Function);
-				}
-			}
-		});
-
-		return Result;
-	}();
-
-	if (const TArray<UFunction*>* Functions = Cache.Find(Object))
+	if (const TArray<UFunction*>* Functions = FTsuExtensionIndex::Get().FindExtensionMethods(Object))
 	{
 		for (UFunction* Function : *Functions)
 			Visitor(Function);
@@ -420,28 +329,7 @@ void FTsuReflection::VisitExtensionMethods(const ExtensionVisitor& Visitor, UStr
 
 void FTsuReflection::VisitStaticExtensionMethods(const StaticExtensionVisitor& Visitor, UStruct* Object)
 {
-	using FCache = TMap<UStruct*, TArray<UFunction*>>;
-
-	static const FCache Cache = [&]
-	{
-		FCache Result;
-
-		VisitFunctionLibraries([&](UClass* Library)
-		{
-			for (auto Function : TImmediateFieldRange<UFunction>(Library))
-			{
-				if (UStruct* Type = FindExtendedTypeStatic(Function))
-				{
-					if (CanLibraryExtendType(Library, Type))
-						Result.FindOrAdd(Type).Add(Function);
-				}
-			}
-		});
-
-		return Result;
-	}();
-
-	if (const TArray<UFunction*>* Functions = Cache.Find(Object))
+	if (const TArray<UFunction*>* Functions = FTsuExtensionIndex::Get().FindStaticExtensionMethods(Object))
 	{
 		for (UFunction* Function : *Functions)
 			Visitor(Function);
@@ -450,28 +338,7 @@ void FTsuReflection::VisitStaticExtensionMethods(const StaticExtensionVisitor& V
 
 void FTsuReflection::VisitExtensionConstants(const ConstantVisitor& Visitor, UStruct* Object)
 {
-	using FCache = TMap<UStruct*, TArray<UFunction*>>;
-
-	static const FCache Cache = [&]
-	{
-		FCache Result;
-
-		VisitFunctionLibraries([&](UClass* Library)
-		{
-			for (auto Function : TImmediateFieldRange<UFunction>(Library))
-			{
-				if (UStruct* Type = FindExtendedTypeConstant(Function))
-				{
-					if (CanLibraryExtendType(Library, Type))
-						Result.FindOrAdd(Type).Add(Function);
-				}
-			}
-		});
-
-		return Result;
-	}();
-
-	if (const TArray<UFunction*>* Functions = Cache.Find(Object))
+	if (const TArray<UFunction*>* Functions = FTsuExtensionIndex::Get().FindExtensionConstants(Object))
 	{
 		for (UFunction* Function : *Functions)
 			Visitor(Function);
@@ -656,15 +523,7 @@ UFunction* FTsuReflection::FindMakeFunction(UStruct* Struct)
 	if (!ScriptStruct)
 		return nullptr;
 
-	UFunction* Result = nullptr;
-
-	VisitMakeFunctions([&](UFunction* Function, UScriptStruct* ScriptStruct)
-	{
-		if (ScriptStruct == Struct)
-			Result = Function;
-	});
-
-	return Result;
+	return FTsuExtensionIndex::Get().GetMakeFunctions().FindRef(ScriptStruct);
 }
 
 UFunction* FTsuReflection::FindBreakFunction(UStruct* Struct)
@@ -673,15 +532,7 @@ UFunction* FTsuReflection::FindBreakFunction(UStruct* Struct)
 	if (!ScriptStruct)
 		return nullptr;
 
-	UFunction* Result = nullptr;
-
-	VisitBreakFunctions([&](UFunction* Function, UScriptStruct* ScriptStruct)
-	{
-		if (ScriptStruct == Struct)
-			Result = Function;
-	});
-
-	return Result;
+	return FTsuExtensionIndex::Get().GetBreakFunctions().FindRef(ScriptStruct);
 }
 
 bool FTsuReflection::HasMakeFunction(UStruct* Struct)
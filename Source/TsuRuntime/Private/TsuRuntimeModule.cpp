@@ -2,9 +2,12 @@
 
 #include "TsuBlueprint.h"
 #include "TsuContext.h"
+#include "TsuExtensionIndex.h"
 #include "TsuPaths.h"
 #include "TsuRuntimeBlueprintCompiler.h"
+#include "TsuStaticBindings.h"
 #include "TsuInspectorCallback.h"
+#include "TsuTypings.h"
 
 #if WITH_EDITOR
 #include "TsuRuntimeSettings.h"
@@ -21,6 +24,10 @@
 #include "ISettingsModule.h"
 #endif // WITH_EDITOR
 
+#if WITH_HOT_RELOAD
+#include "Misc/HotReloadInterface.h"
+#endif // WITH_HOT_RELOAD
+
 #include "TsuRuntimeLog.h"
 #include "TsuIsolate.h"
 
@@ -36,10 +43,16 @@ public:
 
 		FCoreDelegates::OnPostEngineInit.AddRaw(this, &FTsuRuntimeModule::OnPostEngineInit);
 		FCoreDelegates::OnExit.AddRaw(this, &FTsuRuntimeModule::OnExit);
+
+		FTsuExtensionIndex::AddDelegates();
 	}
 
 	void ShutdownModule() override
 	{
+		// The background task would otherwise keep saving typings while the module goes away underneath it
+		FTsuTypings::CancelTypingsAsync();
+
+		FTsuExtensionIndex::RemoveDelegates();
 		RemoveCleanupDelegates();
 		UnregisterSettings();
 
@@ -127,6 +140,9 @@ private:
 				&FTsuRuntimeModule::MakeCompiler);
 		}
 
+		// GEditor didn't exist yet when the module started up
+		FTsuExtensionIndex::AddDelegates();
+
 		RegisterSettings();
 		InitializeV8();
 		FTsuContext::Get();
@@ -187,6 +203,19 @@ private:
 			{
 				FTsuContext::Destroy();
 			});
+
+#if WITH_HOT_RELOAD
+		// Script constants are frozen into the templates and static bindings are linked against the modules from before the reload
+		if (IHotReloadInterface* HotReload = IHotReloadInterface::GetPtr())
+		{
+			HandleHotReload = HotReload->OnHotReload().AddLambda(
+				[](bool /*bWasTriggeredAutomatically*/)
+				{
+					FTsuContext::Destroy();
+					FTsuStaticBindings::Disable();
+				});
+		}
+#endif // WITH_HOT_RELOAD
 	}
 
 	void RemoveCleanupDelegates()
@@ -204,6 +233,11 @@ private:
 		FGameDelegates::Get().GetEndPlayMapDelegate().Remove(HandleEndPlayMap);
 
 		FCoreDelegates::OnPreExit.Remove(HandlePreExit);
+
+#if WITH_HOT_RELOAD
+		if (IHotReloadInterface* HotReload = IHotReloadInterface::GetPtr())
+			HotReload->OnHotReload().Remove(HandleHotReload);
+#endif // WITH_HOT_RELOAD
 	}
 
 	void* HandleV8 = nullptr;
@@ -215,6 +249,7 @@ private:
 	FDelegateHandle HandleWorldDestroyed;
 	FDelegateHandle HandleEndPlayMap;
 	FDelegateHandle HandlePreExit;
+	FDelegateHandle HandleHotReload;
 };
 
 IMPLEMENT_MODULE(FTsuRuntimeModule, TsuRuntime)
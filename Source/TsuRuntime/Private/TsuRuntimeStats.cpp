@@ -0,0 +1,19 @@
+#include "TsuRuntimeStats.h"
+
+DEFINE_STAT(STAT_TsuEvalModule);
+DEFINE_STAT(STAT_TsuInvoke);
+DEFINE_STAT(STAT_TsuInvokeDelegateEvent);
+DEFINE_STAT(STAT_TsuCallMethod);
+DEFINE_STAT(STAT_TsuCallNative);
+DEFINE_STAT(STAT_TsuPopArguments);
+DEFINE_STAT(STAT_TsuWriteParameters);
+DEFINE_STAT(STAT_TsuWriteProperty);
+DEFINE_STAT(STAT_TsuReadProperty);
+DEFINE_STAT(STAT_TsuAddTemplate);
+
+DEFINE_STAT(STAT_TsuAliveObjects);
+DEFINE_STAT(STAT_TsuAliveStructs);
+DEFINE_STAT(STAT_TsuAliveDelegates);
+DEFINE_STAT(STAT_TsuAliveTimers);
+
+DEFINE_STAT(STAT_TsuMarshalledBytes);
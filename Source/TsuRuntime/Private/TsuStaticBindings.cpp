@@ -0,0 +1,121 @@
+#include "TsuStaticBindings.h"
+
+#include "TsuRuntimeLog.h"
+#include "TsuUtilities.h"
+
+#include "UObject/Class.h"
+#include "UObject/UnrealType.h"
+
+#if WITH_TSU_STATIC_BINDINGS
+// Generated by TsuGenerator, defines TsuRegisterStaticBindings
+#include "GeneratedScriptLibraries.inl"
+#endif // WITH_TSU_STATIC_BINDINGS
+
+bool FTsuStaticBindings::bIsDisabled = false;
+
+FTsuStaticBindings& FTsuStaticBindings::Get()
+{
+	static FTsuStaticBindings* Bindings = []
+	{
+		auto Result = new FTsuStaticBindings();
+
+#if WITH_TSU_STATIC_BINDINGS
+		TsuRegisterStaticBindings(*Result);
+
+		UE_LOG(LogTsuRuntime, Log, TEXT("Registered %d static function bindings and %d static property bindings"),
+			Result->Functions.Num(),
+			Result->Properties.Num());
+
+		if (Result->NumRejected > 0)
+		{
+			UE_LOG(LogTsuRuntime, Warning, TEXT("%d static bindings no longer match reflection and will not be used, regenerate them"),
+				Result->NumRejected);
+		}
+#endif // WITH_TSU_STATIC_BINDINGS
+
+		return Result;
+	}();
+
+	return *Bindings;
+}
+
+void FTsuStaticBindings::Disable()
+{
+	bIsDisabled = true;
+}
+
+FTsuStaticBindings::FFunctionStub FTsuStaticBindings::FindFunction(const UFunction* Function) const
+{
+	if (bIsDisabled)
+		return nullptr;
+
+	const FFunctionStub* Stub = Functions.Find(Function);
+	return Stub ? *Stub : nullptr;
+}
+
+const FTsuStaticBindings::FPropertyStubs* FTsuStaticBindings::FindProperty(const UProperty* Property) const
+{
+	return !bIsDisabled ? Properties.Find(Property) : nullptr;
+}
+
+void FTsuStaticBindings::AddFunction(
+	const TCHAR* ClassPath,
+	const TCHAR* Name,
+	FFunctionStub Stub,
+	const TArray<FParamOffset>& Params)
+{
+	UClass* Class = FindObject<UClass>(nullptr, ClassPath);
+	UFunction* Function = Class ? Class->FindFunctionByName(Name, EIncludeSuperFlag::ExcludeSuper) : nullptr;
+	if (!Function)
+	{
+		++NumRejected;
+		return;
+	}
+
+	int32 NumParams = 0;
+	for (UProperty* Param : FParamRange(Function))
+	{
+		const FParamOffset* Expected = Params.FindByPredicate([&](const FParamOffset& Offset)
+		{
+			return Param->GetFName() == Offset.Name;
+		});
+
+		// The stub reads and writes the parameter buffer through its own struct, so it has to line up exactly
+		if (!Expected || Expected->Offset != Param->GetOffset_ForUFunction())
+		{
+			UE_LOG(LogTsuRuntime, Verbose, TEXT("Static binding for '%s' has a mismatched parameter '%s'"),
+				*Function->GetPathName(),
+				*Param->GetName());
+
+			++NumRejected;
+			return;
+		}
+
+		++NumParams;
+	}
+
+	if (NumParams != Params.Num())
+	{
+		++NumRejected;
+		return;
+	}
+
+	Functions.Add(Function, Stub);
+}
+
+void FTsuStaticBindings::AddProperty(
+	const TCHAR* ClassPath,
+	const TCHAR* Name,
+	FPropertyGetter Getter,
+	FPropertySetter Setter)
+{
+	UClass* Class = FindObject<UClass>(nullptr, ClassPath);
+	UProperty* Property = Class ? FindField<UProperty>(Class, Name) : nullptr;
+	if (!Property || Property->GetOwnerClass() != Class)
+	{
+		++NumRejected;
+		return;
+	}
+
+	Properties.Add(Property, FPropertyStubs{Getter, Setter});
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "TsuIsolate.h"
+#include "TsuStringConv.h"
+#include "TsuV8Wrapper.h"
+
+#include "Templates/EnableIf.h"
+#include "Templates/IsArithmetic.h"
+
+/**
+ * The native glue that TsuGenerator emits for the modules listed under `[Tsu] StaticBindingModules` in the
+ * engine config. Function stubs call straight into native code, skipping ProcessEvent and the thunk, and
+ * property stubs convert directly between the member and V8. Stubs are only used once their layout has
+ * been checked against reflection, with reflection being the fallback for everything else.
+ */
+class FTsuStaticBindings
+{
+public:
+	using FFunctionStub = void(*)(UObject* Object, void* Params);
+	using FPropertyGetter = v8::Local<v8::Value>(*)(const UObject* Object);
+	using FPropertySetter = void(*)(UObject* Object, v8::Local<v8::Value> Value);
+
+	struct FParamOffset
+	{
+		const TCHAR* Name;
+		int32 Offset;
+	};
+
+	struct FPropertyStubs
+	{
+		FPropertyGetter Getter;
+		FPropertySetter Setter;
+	};
+
+	/** Gets the bindings, registering the generated ones if needed */
+	static FTsuStaticBindings& Get();
+
+	/**
+	 * Stops handing out stubs for the rest of the session. The stubs are linked against the modules as they
+	 * were when the plugin was built, so they can't be trusted once any of them have been hot reloaded.
+	 */
+	static void Disable();
+
+	FFunctionStub FindFunction(const UFunction* Function) const;
+	const FPropertyStubs* FindProperty(const UProperty* Property) const;
+
+	/**
+	 * Registers a function stub, provided that the parameters are where the stub expects them to be.
+	 *
+	 * @param ClassPath The path of the class that owns the function
+	 * @param Name The name of the function
+	 * @param Stub The stub that calls the function with its parameters read from a parameter buffer
+	 * @param Params The names and offsets of the parameters, as laid out by the stub
+	 */
+	void AddFunction(const TCHAR* ClassPath, const TCHAR* Name, FFunctionStub Stub, const TArray<FParamOffset>& Params);
+
+	/** Registers the stubs for a property, provided that it can be found */
+	void AddProperty(const TCHAR* ClassPath, const TCHAR* Name, FPropertyGetter Getter, FPropertySetter Setter);
+
+private:
+	FTsuStaticBindings() = default;
+
+	static bool bIsDisabled;
+
+	TMap<const UFunction*, FFunctionStub> Functions;
+	TMap<const UProperty*, FPropertyStubs> Properties;
+
+	int32 NumRejected = 0;
+};
+
+/** Conversions used by the generated property stubs */
+template<typename T, typename = void>
+struct TTsuStaticValue;
+
+template<>
+struct TTsuStaticValue<bool>
+{
+	static v8::Local<v8::Value> ToV8(bool Value)
+	{
+		return v8::Boolean::New(FTsuIsolate::Get(), Value);
+	}
+
+	static bool FromV8(v8::Local<v8::Value> Value)
+	{
+		return Value->BooleanValue(FTsuIsolate::Get());
+	}
+};
+
+template<typename T>
+struct TTsuStaticValue<T, typename TEnableIf<TIsIntegral<T>::Value>::Type>
+{
+	static v8::Local<v8::Value> ToV8(T Value)
+	{
+		return v8::Number::New(FTsuIsolate::Get(), (double)Value);
+	}
+
+	static T FromV8(v8::Local<v8::Value> Value)
+	{
+		// Goes through int64 like any other integer property, V8 takes care of NaN and out of range numbers
+		v8::Local<v8::Context> Context = FTsuIsolate::Get()->GetCurrentContext();
+		return (T)Value->IntegerValue(Context).FromMaybe(0);
+	}
+};
+
+template<typename T>
+struct TTsuStaticValue<T, typename TEnableIf<TIsFloatingPoint<T>::Value>::Type>
+{
+	static v8::Local<v8::Value> ToV8(T Value)
+	{
+		return v8::Number::New(FTsuIsolate::Get(), (double)Value);
+	}
+
+	static T FromV8(v8::Local<v8::Value> Value)
+	{
+		v8::Local<v8::Context> Context = FTsuIsolate::Get()->GetCurrentContext();
+		return (T)Value->NumberValue(Context).FromMaybe(0.0);
+	}
+};
+
+template<>
+struct TTsuStaticValue<FString>
+{
+	static v8::Local<v8::Value> ToV8(const FString& Value)
+	{
+		return TCHAR_TO_V8(Value);
+	}
+
+	static FString FromV8(v8::Local<v8::Value> Value)
+	{
+		v8::Local<v8::Context> Context = FTsuIsolate::Get()->GetCurrentContext();
+		v8::Local<v8::String> String;
+		return Value->ToString(Context).ToLocal(&String) ? V8_TO_TCHAR(String) : FString();
+	}
+};
+
+template<>
+struct TTsuStaticValue<FName>
+{
+	static v8::Local<v8::Value> ToV8(const FName& Value)
+	{
+		return TCHAR_TO_V8(Value.ToString());
+	}
+
+	static FName FromV8(v8::Local<v8::Value> Value)
+	{
+		return FName(*TTsuStaticValue<FString>::FromV8(Value));
+	}
+};
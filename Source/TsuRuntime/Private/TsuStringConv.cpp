@@ -23,6 +23,31 @@ FString FTsuStringConv::From(v8::Local<v8::String> String)
 	return FString(UTF8_TO_TCHAR(*StringValue));
 }
 
+void FTsuStringConv::Append(FString& Result, v8::Local<v8::String> String)
+{
+#if PLATFORM_TCHAR_IS_4_BYTES
+	Result += From(String);
+#else // PLATFORM_TCHAR_IS_4_BYTES
+	// Copies straight into the existing buffer, which avoids allocating when it has room to spare
+	const int32 Length = String->Length();
+	if (Length == 0)
+		return;
+
+	TArray<TCHAR>& Chars = Result.GetCharArray();
+	const int32 Offset = Result.Len();
+	Chars.SetNumUninitialized(Offset + Length + 1, /*bAllowShrinking=*/false);
+
+	String->Write(
+		FTsuIsolate::Get(),
+		reinterpret_cast<uint16_t*>(Chars.GetData() + Offset),
+		0,
+		Length,
+		v8::String::NO_NULL_TERMINATION);
+
+	Chars[Offset + Length] = TEXT('\0');
+#endif // PLATFORM_TCHAR_IS_4_BYTES
+}
+
 v8::Local<v8::String> operator""_v8(const char16_t* StringPtr, size_t StringLen)
 {
 	return v8::String::NewFromTwoByte(
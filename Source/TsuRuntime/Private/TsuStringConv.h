@@ -10,6 +10,7 @@ public:
 	static v8::Local<v8::String> To(const TCHAR* String, int32 Length = -1);
 	static v8::Local<v8::String> To(const FString& String);
 	static FString From(v8::Local<v8::String> String);
+	static void Append(FString& Result, v8::Local<v8::String> String);
 };
 
 v8::Local<v8::String> operator""_v8(const char16_t* StringPtr, size_t StringLen);
@@ -0,0 +1,11 @@
+#include "TsuTrace.h"
+
+#if TSU_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_DEFINE(TsuChannel)
+
+#elif STATS
+
+const FColor FTsuNamedEventScope::Color{49, 120, 198};
+
+#endif // TSU_TRACE_ENABLED
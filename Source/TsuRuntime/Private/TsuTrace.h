@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Runtime/Launch/Resources/Version.h"
+
+// Channels and dynamically named CPU events only made it into the trace API in 4.26
+#if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION >= 26
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#define TSU_TRACE_ENABLED (UE_TRACE_ENABLED && CPUPROFILERTRACE_ENABLED)
+#else
+#define TSU_TRACE_ENABLED 0
+#endif
+
+#if TSU_TRACE_ENABLED
+
+#include "ProfilingDebugging/MiscTrace.h"
+#include "Trace/Trace.h"
+
+UE_TRACE_CHANNEL_EXTERN(TsuChannel)
+
+/** Opens a CPU timing event on TsuChannel for the rest of the scope, only formatting its name if the channel is enabled */
+#define TSU_TRACE_SCOPE(Format, ...)                                                                            \
+	TOptional<FCpuProfilerTrace::FDynamicEventScope> PREPROCESSOR_JOIN(TsuTraceScope, __LINE__);                \
+	if (UE_TRACE_CHANNELEXPR_IS_ENABLED(TsuChannel))                                                            \
+		PREPROCESSOR_JOIN(TsuTraceScope, __LINE__).Emplace(*FString::Printf(Format, ##__VA_ARGS__), TsuChannel)
+
+/** Emits a bookmark if TsuChannel is enabled */
+#define TSU_TRACE_BOOKMARK(Format, ...)              \
+	if (UE_TRACE_CHANNELEXPR_IS_ENABLED(TsuChannel)) \
+	{                                                \
+		TRACE_BOOKMARK(Format, ##__VA_ARGS__);       \
+	}
+
+#elif STATS
+
+#include "HAL/PlatformMisc.h"
+#include "Stats/Stats.h"
+
+/**
+ * Engines that predate trace channels get named events instead, which show up in Unreal Insights as well as
+ * external profilers. These are only emitted while `stat namedevents` is on, which stands in for TsuChannel.
+ */
+struct FTsuNamedEventScope
+{
+	static const FColor Color;
+
+	bool bIsActive = false;
+
+	void Begin(const TCHAR* Name)
+	{
+		FPlatformMisc::BeginNamedEvent(Color, Name);
+		bIsActive = true;
+	}
+
+	~FTsuNamedEventScope()
+	{
+		if (bIsActive)
+			FPlatformMisc::EndNamedEvent();
+	}
+};
+
+#define TSU_TRACE_SCOPE(Format, ...)                                                                                 \
+	FTsuNamedEventScope PREPROCESSOR_JOIN(TsuTraceScope, __LINE__);                                                \
+	if (GCycleStatsShouldEmitNamedEvents > 0)                                                                        \
+		PREPROCESSOR_JOIN(TsuTraceScope, __LINE__).Begin(*FString::Printf(Format, ##__VA_ARGS__))
+
+/** Bookmarks become empty named events, which profilers show as markers */
+#define TSU_TRACE_BOOKMARK(Format, ...)                                                                              \
+	if (GCycleStatsShouldEmitNamedEvents > 0)                                                                        \
+	{                                                                                                                \
+		FPlatformMisc::BeginNamedEvent(FTsuNamedEventScope::Color, *FString::Printf(Format, ##__VA_ARGS__));        \
+		FPlatformMisc::EndNamedEvent();                                                                              \
+	}
+
+#else // TSU_TRACE_ENABLED
+
+#define TSU_TRACE_SCOPE(Format, ...)
+#define TSU_TRACE_BOOKMARK(Format, ...)
+
+#endif // TSU_TRACE_ENABLED
@@ -1,6 +1,7 @@
 #include "TsuTryCatch.h"
 
 #include "TsuRuntimeLog.h"
+#include "TsuRuntimeSettings.h"
 #include "TsuStringConv.h"
 #include "TsuUtilities.h"
 
@@ -9,6 +10,39 @@
 #include "Widgets/Notifications/SNotificationList.h"
 #endif // WITH_EDITOR
 
+#include "HAL/PlatformTime.h"
+
+namespace TsuTryCatch_Private
+{
+
+struct FThrottledException
+{
+	/** When the exception was last reported in full, in seconds */
+	double LastReportTime = 0.0;
+
+	/** How many times the exception has been thrown since it was last reported */
+	int32 NumSuppressed = 0;
+};
+
+/** Keyed by the location that the exception was thrown from */
+TMap<uint32, FThrottledException> ThrottledExceptions;
+
+/** How many exceptions went unreported this frame */
+int32 NumSuppressedThisFrame = 0;
+
+uint32 GetLocationHash(v8::Local<v8::Context> Context, v8::Local<v8::Message> Message)
+{
+	v8::Local<v8::Value> ResourceName = Message->GetScriptResourceName();
+	const FString ScriptName = ResourceName->IsString() ? V8_TO_TCHAR(ResourceName.As<v8::String>()) : FString();
+
+	uint32 Hash = GetTypeHash(ScriptName);
+	Hash = HashCombine(Hash, GetTypeHash(Message->GetLineNumber(Context).FromMaybe(0)));
+	Hash = HashCombine(Hash, GetTypeHash(Message->GetStartColumn(Context).FromMaybe(0)));
+	return Hash;
+}
+
+} // namespace TsuTryCatch_Private
+
 FTsuTryCatch::FTsuTryCatch(v8::Isolate* Isolate)
 	: Isolate(Isolate)
 	, Catcher(Isolate)
@@ -20,17 +54,47 @@ FTsuTryCatch::~FTsuTryCatch()
 	Check();
 }
 
-void FTsuTryCatch::Check()
+bool FTsuTryCatch::Check()
 {
+	using namespace TsuTryCatch_Private;
+
 	if (!Catcher.HasCaught())
-		return;
+		return false;
+
+	// Execution gets terminated when scripts exceed the heap limit, see FTsuIsolate::OnNearHeapLimit
+	if (Catcher.HasTerminated())
+	{
+		UE_LOG(LogTsuRuntime, Error, TEXT("[V8] Script execution was terminated"));
+		Isolate->CancelTerminateExecution();
+		Catcher.Reset();
+		return true;
+	}
 
 	v8::Local<v8::Context> Context = Isolate->GetCurrentContext();
 	v8::Local<v8::Message> Exception = Catcher.Message();
 
+	// A callback that throws every tick would otherwise format and log its whole stack every tick
+	FThrottledException& Throttled = ThrottledExceptions.FindOrAdd(GetLocationHash(Context, Exception));
+	const double CurrentTime = FPlatformTime::Seconds();
+	const double ReportInterval = GetDefault<UTsuRuntimeSettings>()->ExceptionReportInterval;
+
+	if (Throttled.LastReportTime > 0.0 && CurrentTime - Throttled.LastReportTime < ReportInterval)
+	{
+		++Throttled.NumSuppressed;
+		++NumSuppressedThisFrame;
+		Catcher.Reset();
+		return true;
+	}
+
 	const FString Message = TEXT("[V8] ") + V8_TO_TCHAR(Exception->Get());
 
-	UE_LOG(LogTsuRuntime, Error, TEXT("%s"), *Message);
+	if (Throttled.NumSuppressed > 0)
+		UE_LOG(LogTsuRuntime, Error, TEXT("%s (thrown %d more times since last reported)"), *Message, Throttled.NumSuppressed);
+	else
+		UE_LOG(LogTsuRuntime, Error, TEXT("%s"), *Message);
+
+	Throttled.LastReportTime = CurrentTime;
+	Throttled.NumSuppressed = 0;
 
 	v8::Local<v8::StackTrace> StackTrace = Exception->GetStackTrace();
 	const int32 NumFrames = StackTrace->GetFrameCount();
@@ -76,4 +140,29 @@ void FTsuTryCatch::Check()
 #endif // WITH_EDITOR
 
 	Catcher.Reset();
+	return true;
+}
+
+void FTsuTryCatch::FlushSuppressedExceptions()
+{
+	using namespace TsuTryCatch_Private;
+
+	if (NumSuppressedThisFrame > 0)
+	{
+		UE_LOG(LogTsuRuntime, Error, TEXT("[V8] %d repeated exceptions were not reported this frame"), NumSuppressedThisFrame);
+		NumSuppressedThisFrame = 0;
+	}
+
+	if (ThrottledExceptions.Num() == 0)
+		return;
+
+	// Forget about locations that have gone quiet, so that the map doesn't grow forever
+	const double CurrentTime = FPlatformTime::Seconds();
+	const double ReportInterval = GetDefault<UTsuRuntimeSettings>()->ExceptionReportInterval;
+
+	for (auto It = ThrottledExceptions.CreateIterator(); It; ++It)
+	{
+		if (It->Value.NumSuppressed == 0 && CurrentTime - It->Value.LastReportTime >= ReportInterval)
+			It.RemoveCurrent();
+	}
 }
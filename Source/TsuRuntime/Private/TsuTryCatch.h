@@ -13,7 +13,16 @@ public:
 	FTsuTryCatch(const FTsuTryCatch& Other) = delete;
 	FTsuTryCatch& operator=(const FTsuTryCatch& Other) = delete;
 
-	void Check();
+	/**
+	 * Reports whatever exception was caught, if any, and then resets the catcher. Exceptions thrown from
+	 * the same location are only reported in full once every UTsuRuntimeSettings::ExceptionReportInterval.
+	 *
+	 * @returns Whether an exception was caught
+	 */
+	bool Check();
+
+	/** Logs how many exceptions were left unreported during the frame, meant to be called once per frame */
+	static void FlushSuppressedExceptions();
 
 private:
 	v8::Isolate* Isolate = nullptr;
@@ -1,21 +1,28 @@
 #include "TsuTypeIndex.h"
 
+#include "TsuPaths.h"
 #include "TsuReflection.h"
 #include "TsuRuntimeLog.h"
 #include "TsuTypings.h"
 
+#include "Dom/JsonObject.h"
 #include "Editor.h"
 #include "Engine/BlueprintGeneratedClass.h"
+#include "HAL/PlatformTime.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
 #include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectIterator.h"
 
 FTsuTypeIndex::FTsuTypeIndex()
 {
 	Index.Reserve(1024);
 
-	FTsuReflection::VisitAllTypes([&](UField* Type, const FTsuTypeSet& /*References*/)
-	{
-		Index.Emplace(FTsuTypings::TailorNameOfType(Type), Type);
-	});
+	LoadPersistedPaths();
 
 #if WITH_EDITOR
 	if (GEditor)
@@ -31,17 +38,177 @@ FTsuTypeIndex::FTsuTypeIndex()
 
 UField* FTsuTypeIndex::Find(const FString& TypeName)
 {
-	UField* Result = Index.FindRef(TypeName);
+	if (UField* IndexedType = Index.FindRef(TypeName))
+		return IndexedType;
+
+	UField* Result = FindByObjectName(TypeName);
+
+	if (!Result)
+		Result = FindByPersistedPath(TypeName);
 
 	// If we can't find the type, we assume that it's a not-yet-indexed blueprint
 	if (!Result)
 	{
 		if (auto Blueprint = FindObject<UBlueprint>(ANY_PACKAGE, *TypeName, true))
-		{
 			Result = Blueprint->GeneratedClass;
-			Index.Add(TypeName) = Result;
-		}
 	}
 
+	// Renamed types that were loaded after the persisted paths were last saved
+	if (!Result && !bHasIndexedAllTypes)
+	{
+		IndexAllTypes();
+		return Index.FindRef(TypeName);
+	}
+
+	if (Result)
+		Index.Add(TypeName, Result);
+
 	return Result;
 }
+
+UField* FTsuTypeIndex::FindByObjectName(const FString& TypeName)
+{
+	auto IsMatch = [&](UField* Type)
+	{
+		return Type && IsIndexableType(Type) && FTsuTypings::TailorNameOfType(Type) == TypeName;
+	};
+
+	if (auto Class = FindObject<UClass>(ANY_PACKAGE, *TypeName))
+	{
+		if (IsMatch(Class))
+			return Class;
+	}
+
+	if (auto Struct = FindObject<UScriptStruct>(ANY_PACKAGE, *TypeName))
+	{
+		if (IsMatch(Struct))
+			return Struct;
+	}
+
+	if (auto Enum = FindObject<UEnum>(ANY_PACKAGE, *TypeName))
+	{
+		if (IsMatch(Enum))
+			return Enum;
+	}
+
+	return nullptr;
+}
+
+UField* FTsuTypeIndex::FindByPersistedPath(const FString& TypeName)
+{
+	const FString* Path = PersistedPaths.Find(TypeName);
+	if (!Path)
+		return nullptr;
+
+	// The path might have gone stale without the version changing, so we still verify what we find
+	auto Type = FindObject<UField>(nullptr, **Path);
+	if (!Type || !IsIndexableType(Type) || FTsuTypings::TailorNameOfType(Type) != TypeName)
+		return nullptr;
+
+	return Type;
+}
+
+void FTsuTypeIndex::IndexAllTypes()
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	bHasIndexedAllTypes = true;
+	PersistedPaths.Reset();
+
+	auto IndexType = [&](UField* Type)
+	{
+		if (!IsIndexableType(Type))
+			return;
+
+		const FString& TypeName = FTsuTypings::TailorNameOfType(Type);
+		Index.Emplace(TypeName, Type);
+
+		if (TypeName != Type->GetName())
+			PersistedPaths.Emplace(TypeName, Type->GetPathName());
+	};
+
+	for (auto Class : TObjectRange<UClass>())
+		IndexType(Class);
+
+	for (auto Struct : TObjectRange<UScriptStruct>())
+		IndexType(Struct);
+
+	for (auto Enum : TObjectRange<UEnum>())
+		IndexType(Enum);
+
+	SavePersistedPaths();
+
+	UE_LOG(LogTsuRuntime, Log, TEXT("Indexed %d types in %.1f ms"),
+		Index.Num(),
+		(FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void FTsuTypeIndex::LoadPersistedPaths()
+{
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *FTsuPaths::TypeIndexPath()))
+		return;
+
+	TSharedPtr<FJsonObject> Root;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root) || !Root.IsValid())
+		return;
+
+	if (Root->GetStringField(TEXT("version")) != ComputeVersionHash())
+		return;
+
+	const TSharedPtr<FJsonObject>* Types = nullptr;
+	if (!Root->TryGetObjectField(TEXT("types"), Types))
+		return;
+
+	PersistedPaths.Reserve((*Types)->Values.Num());
+
+	for (const auto& Entry : (*Types)->Values)
+		PersistedPaths.Emplace(Entry.Key, Entry.Value->AsString());
+}
+
+void FTsuTypeIndex::SavePersistedPaths() const
+{
+	FString Json;
+
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("version"), ComputeVersionHash());
+
+	Writer->WriteObjectStart(TEXT("types"));
+	for (const auto& Entry : PersistedPaths)
+		Writer->WriteValue(Entry.Key, Entry.Value);
+	Writer->WriteObjectEnd();
+
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	if (!FFileHelper::SaveStringToFile(Json, *FTsuPaths::TypeIndexPath()))
+		UE_LOG(LogTsuRuntime, Warning, TEXT("Failed to save type index to '%s'"), *FTsuPaths::TypeIndexPath());
+}
+
+bool FTsuTypeIndex::IsIndexableType(UField* Type)
+{
+	if (!Type->IsA<UClass>() && !Type->IsA<UScriptStruct>() && !Type->IsA<UEnum>())
+		return false;
+
+	if (FTsuReflection::IsInternalType(Type))
+		return false;
+
+	if (auto Class = Cast<UClass>(Type))
+		return FTsuReflection::IsValidClass(Class);
+
+	return true;
+}
+
+FString FTsuTypeIndex::ComputeVersionHash()
+{
+	uint32 Hash = GetTypeHash(FEngineVersion::Current().ToString());
+
+	for (const TSharedRef<IPlugin>& Plugin : IPluginManager::Get().GetEnabledPlugins())
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Plugin->GetName()));
+		Hash = HashCombine(Hash, GetTypeHash(Plugin->GetDescriptor().VersionName));
+	}
+
+	return FString::Printf(TEXT("%08x"), Hash);
+}
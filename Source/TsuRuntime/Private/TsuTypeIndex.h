@@ -4,6 +4,12 @@
 
 #include "Engine/Blueprint.h"
 
+/**
+ * Maps the names that scripts use for types to the types themselves. Names are resolved lazily, mostly
+ * through regular object lookups. Types whose script name differs from their object name are found
+ * through a map of paths, which is persisted between sessions and thrown away whenever the engine or
+ * any plugin changes version. Only when all of that fails do we fall back to walking every type.
+ */
 class FTsuTypeIndex
 {
 public:
@@ -12,5 +18,22 @@ public:
 	UField* Find(const FString& TypeName);
 
 private:
+	/** Finds types whose name in scripts is the same as their object name, which is most of them */
+	UField* FindByObjectName(const FString& TypeName);
+
+	/** Finds types whose name in scripts was changed, through the persisted paths */
+	UField* FindByPersistedPath(const FString& TypeName);
+
+	/** Indexes every loaded type, and persists the paths of any renamed ones */
+	void IndexAllTypes();
+
+	void LoadPersistedPaths();
+	void SavePersistedPaths() const;
+
+	static bool IsIndexableType(UField* Type);
+	static FString ComputeVersionHash();
+
 	TMap<FString, UField*> Index;
+	TMap<FString, FString> PersistedPaths;
+	bool bHasIndexedAllTypes = false;
 };
@@ -6,21 +6,183 @@
 #include "TsuRuntimeLog.h"
 #include "TsuUtilities.h"
 
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
 #include "Engine/Engine.h"
+#include "HAL/FileManager.h"
 #include "HAL/PlatformFilemanager.h"
+#include "HAL/PlatformTime.h"
 #include "Internationalization/Regex.h"
+#include "Misc/Crc.h"
 #include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeRWLock.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
 #include "UObject/EnumProperty.h"
+#include "UObject/MetaData.h"
 #include "UObject/Package.h"
 #include "UObject/TextProperty.h"
 #include "UObject/UnrealType.h"
 
+#if WITH_EDITOR
+#include "Framework/Notifications/NotificationManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
+#endif // WITH_EDITOR
+
 #define TSU_WRITE(Format) Output.Append(TEXT(Format), ARRAY_COUNT(Format) - 1)
 #define TSU_WRITELN(Format) TSU_WRITE(Format "\n")
 
 #define TSU_WRITEF(Format, ...) Output.Append(FString::Printf(TEXT(Format), __VA_ARGS__))
 #define TSU_WRITELNF(Format, ...) TSU_WRITEF(Format "\n", __VA_ARGS__)
 
+namespace TsuTypings_Private
+{
+
+/** Bump this whenever the output changes in a way that the signature hashes wouldn't pick up */
+const int32 TypingsVersion = 2;
+
+/**
+ * Cache of tailored names, which gets shared between the threads that write typings. The names are
+ * heap allocated so that references to them stay valid while other threads add to the cache.
+ */
+template<typename KeyType>
+class TNameCache
+{
+public:
+	explicit TNameCache(int32 ExpectedNum)
+	{
+		Cache.Reserve(ExpectedNum);
+	}
+
+	template<typename FactoryType>
+	const FString& FindOrAdd(KeyType Key, FName KeyName, FactoryType&& Factory)
+	{
+		{
+			FRWScopeLock ReadLock{Lock, SLT_ReadOnly};
+
+			if (const TUniquePtr<FCachedName>* CachedName = Cache.Find(Key))
+			{
+				if ((*CachedName)->Key == KeyName)
+					return (*CachedName)->Value;
+			}
+		}
+
+		// The factory can end up tailoring other names, so it can't run while we hold the lock
+		FString Name = Factory();
+
+		FRWScopeLock WriteLock{Lock, SLT_Write};
+
+		TUniquePtr<FCachedName>& CachedName = Cache.FindOrAdd(Key);
+		if (!CachedName.IsValid())
+			CachedName = MakeUnique<FCachedName>();
+
+		if (CachedName->Key != KeyName)
+		{
+			CachedName->Key = KeyName;
+			CachedName->Value = MoveTemp(Name);
+		}
+
+		return CachedName->Value;
+	}
+
+private:
+	using FCachedName = TPair<FName, FString>;
+
+	FRWLock Lock;
+	TMap<KeyType, TUniquePtr<FCachedName>> Cache;
+};
+
+FString GetTypingsManifestPath()
+{
+	return FPaths::Combine(FTsuPaths::TypingsDir(), TEXT("manifest.json"));
+}
+
+/** Whether typings are currently being written in the background */
+bool bIsWritingTypingsAsync = false;
+
+/** Whether typings were requested again while they were being written in the background */
+bool bIsAsyncRerunRequested = false;
+
+/** Tells the background task to stop saving typings, such as when the module is shutting down */
+FThreadSafeBool bIsAsyncCancelRequested;
+
+/** The task saving typings in the background */
+TFuture<void> AsyncSaveTask;
+
+
+/** Shows the progress of typings being written in the background, without blocking the editor */
+class FTypingsProgress
+{
+public:
+	explicit FTypingsProgress(int32 InNumTotal)
+		: NumTotal(InNumTotal)
+	{
+#if WITH_EDITOR
+		if (IsRunningCommandlet() || NumTotal == 0)
+			return;
+
+		FNotificationInfo Info{GetProgressText()};
+		Info.bFireAndForget = false;
+		Info.bUseThrobber = true;
+		Info.bUseSuccessFailIcons = true;
+		Info.ExpireDuration = 3.0f;
+
+		Notification = FSlateNotificationManager::Get().AddNotification(Info);
+		if (Notification.IsValid())
+			Notification->SetCompletionState(SNotificationItem::CS_Pending);
+#endif // WITH_EDITOR
+	}
+
+	FThreadSafeCounter NumWritten;
+
+	/** Updates the notification, meant to be called from the game thread */
+	void Update()
+	{
+#if WITH_EDITOR
+		if (Notification.IsValid())
+			Notification->SetText(GetProgressText());
+#endif // WITH_EDITOR
+	}
+
+	/** Lets the notification fade out, meant to be called from the game thread */
+	void Finish(bool bSucceeded)
+	{
+#if WITH_EDITOR
+		if (Notification.IsValid())
+		{
+			Notification->SetText(FText::FromString(FString::Printf(TEXT("Generated typings for %d types"), NumTotal)));
+			Notification->SetCompletionState(bSucceeded ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+			Notification->ExpireAndFadeout();
+			Notification.Reset();
+		}
+#endif // WITH_EDITOR
+	}
+
+private:
+	FText GetProgressText() const
+	{
+		return FText::FromString(FString::Printf(TEXT("Generating typings (%d/%d)"), NumWritten.GetValue(), NumTotal));
+	}
+
+	int32 NumTotal;
+
+#if WITH_EDITOR
+	TSharedPtr<SNotificationItem> Notification;
+#endif // WITH_EDITOR
+};
+
+/** The ticker that reports progress and finishes up once the background task is done */
+FDelegateHandle AsyncSaveTicker;
+
+/** The progress of the background task, which is only ever touched from the game thread */
+TUniquePtr<FTypingsProgress> AsyncProgress;
+
+} // namespace TsuTypings_Private
+
 const TCHAR* FTsuTypings::MetaHidden = TEXT("Hidden");
 const TCHAR* FTsuTypings::MetaDisplayName = TEXT("DisplayName");
 const FName FTsuTypings::MetaScriptName = TEXT("ScriptName");
@@ -30,8 +192,9 @@ const FName FTsuTypings::MetaScriptConstant = TEXT("ScriptConstant");
 
 FString& FTsuTypings::ResetPersistentOutputBuffer()
 {
-	static FString Buffer;
-	Buffer.Reserve(8 * 1024 * 1024);
+	// Typings are written from several threads at once, so each of them gets its own buffer
+	static thread_local FString Buffer;
+	Buffer.Reserve(1024 * 1024);
 	Buffer.Reset();
 	return Buffer;
 }
@@ -107,16 +270,199 @@ bool FTsuTypings::IsReservedIdentifier(const FString& Word)
 
 void FTsuTypings::WriteAllTypings()
 {
+	const double StartTime = FPlatformTime::Seconds();
+
+	WriteCoreTypings();
+	WriteGlobalTypings();
+	WriteKeyTypings();
+
+	FPendingTypings Pending;
+	GatherPendingTypings(Pending);
+	FormatPendingTypings(Pending);
+	SavePendingTypings(Pending, nullptr, nullptr);
+
+	UE_LOG(LogTsuRuntime, Log, TEXT("Generated typings for %d out of %d types in %.1f ms"),
+		Pending.Outputs.Num(),
+		Pending.Manifest.Num(),
+		(FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void FTsuTypings::WriteAllTypingsAsync()
+{
+	using namespace TsuTypings_Private;
+
+	check(IsInGameThread());
+
+	// There's nothing else for a commandlet to be doing in the meantime
+	if (IsRunningCommandlet())
+	{
+		WriteAllTypings();
+		return;
+	}
+
+	if (bIsWritingTypingsAsync)
+	{
+		bIsAsyncRerunRequested = true;
+		return;
+	}
+
+	bIsWritingTypingsAsync = true;
+
+	const double StartTime = FPlatformTime::Seconds();
+
 	WriteCoreTypings();
 	WriteGlobalTypings();
 	WriteKeyTypings();
 
+	TSharedRef<FPendingTypings, ESPMode::ThreadSafe> Pending = MakeShared<FPendingTypings, ESPMode::ThreadSafe>();
+	GatherPendingTypings(*Pending);
+
+	// Formatting reads reflection data, so only the file I/O is left for the background task
+	FormatPendingTypings(*Pending);
+
+	// The notification is a Slate widget, so the progress stays on the game thread and outlives the task
+	AsyncProgress = MakeUnique<FTypingsProgress>(Pending->Outputs.Num());
+	FThreadSafeCounter* NumWritten = &AsyncProgress->NumWritten;
+
+	bIsAsyncCancelRequested = false;
+
+	AsyncSaveTask = Async<void>(EAsyncExecution::ThreadPool, [Pending, NumWritten]
+	{
+		SavePendingTypings(*Pending, NumWritten, &bIsAsyncCancelRequested);
+	});
+
+	// Polled rather than signalled from the task, so that CancelTypingsAsync has nothing left in flight once it returns
+	AsyncSaveTicker = FTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateLambda([Pending, StartTime](float /*DeltaTime*/)
+		{
+			AsyncProgress->Update();
+
+			if (!AsyncSaveTask.IsReady())
+				return true;
+
+			AsyncSaveTask.Reset();
+			AsyncSaveTicker.Reset();
+
+			AsyncProgress->Finish(Pending->NumFailed == 0);
+			AsyncProgress.Reset();
+
+			UE_LOG(LogTsuRuntime, Log, TEXT("Generated typings for %d out of %d types in %.1f ms"),
+				Pending->Outputs.Num(),
+				Pending->Manifest.Num(),
+				(FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+			bIsWritingTypingsAsync = false;
+
+			if (bIsAsyncRerunRequested)
+			{
+				bIsAsyncRerunRequested = false;
+				WriteAllTypingsAsync();
+			}
+
+			return false;
+		}),
+		0.1f);
+}
+
+bool FTsuTypings::IsWritingTypingsAsync()
+{
+	return TsuTypings_Private::bIsWritingTypingsAsync;
+}
+
+void FTsuTypings::CancelTypingsAsync()
+{
+	using namespace TsuTypings_Private;
+
+	check(IsInGameThread());
+
+	if (!bIsWritingTypingsAsync)
+		return;
+
+	bIsAsyncRerunRequested = false;
+	bIsAsyncCancelRequested = true;
+
+	// Whatever was skipped is left out of the manifest, so it gets written next time around
+	AsyncSaveTask.Wait();
+	AsyncSaveTask.Reset();
+
+	AsyncProgress->Finish(false);
+	AsyncProgress.Reset();
+
+	FTicker::GetCoreTicker().RemoveTicker(AsyncSaveTicker);
+	AsyncSaveTicker.Reset();
+
+	bIsWritingTypingsAsync = false;
+}
+
+void FTsuTypings::GatherPendingTypings(FPendingTypings& OutPending)
+{
+	const TMap<FString, uint32> OldManifest = LoadTypingsManifest();
+	OutPending.Manifest.Reserve(OldManifest.Num());
+
+	// Hashing also tailors all of the names up front, so the workers mostly find them already cached
 	FTsuReflection::VisitAllTypes([&](UField* Type, const FTsuTypeSet& References)
 	{
-		WriteTypings(Type, References);
+		const FString& TypeName = TailorNameOfType(Type);
+		const uint32 Hash = HashTypings(Type, References);
+
+		OutPending.Manifest.Add(TypeName, Hash);
+
+		const uint32* OldHash = OldManifest.Find(TypeName);
+		if (OldHash && *OldHash == Hash && DoTypingsExist(*TypeName))
+			return;
+
+		OutPending.Types.Emplace(Type, References);
 	});
 }
 
+void FTsuTypings::FormatPendingTypings(FPendingTypings& Pending)
+{
+	check(IsInGameThread());
+
+	Pending.Outputs.SetNum(Pending.Types.Num());
+
+	// The game thread waits on the workers, so nothing can change or collect the types while they're being read
+	ParallelFor(Pending.Types.Num(), [&](int32 Index)
+	{
+		UField* Type = Pending.Types[Index].Key;
+		Pending.Outputs[Index] = MakeTuple(TailorNameOfType(Type), FormatTypings(Type, Pending.Types[Index].Value));
+	});
+
+	// Nothing past this point gets to touch the types themselves
+	Pending.Types.Empty();
+}
+
+void FTsuTypings::SavePendingTypings(FPendingTypings& Pending, FThreadSafeCounter* NumWritten, const FThreadSafeBool* bIsCancelled)
+{
+	TArray<bool> Results;
+	Results.SetNumZeroed(Pending.Outputs.Num());
+
+	ParallelFor(Pending.Outputs.Num(), [&](int32 Index)
+	{
+		if (bIsCancelled && *bIsCancelled)
+			return;
+
+		const TPair<FString, FString>& Output = Pending.Outputs[Index];
+		Results[Index] = SaveTypings(Output.Key, Output.Value);
+
+		if (NumWritten)
+			NumWritten->Increment();
+	});
+
+	// Anything that failed or was skipped should be retried next time around
+	for (int32 Index = 0; Index < Results.Num(); ++Index)
+	{
+		if (!Results[Index])
+		{
+			Pending.Manifest.Remove(Pending.Outputs[Index].Key);
+			++Pending.NumFailed;
+		}
+	}
+
+	// Written last, so that an interrupted run just regenerates the same types again
+	SaveTypingsManifest(Pending.Manifest);
+}
+
 void FTsuTypings::WriteCoreTypings()
 {
 	FString& Output = ResetPersistentOutputBuffer();
@@ -188,6 +534,8 @@ void FTsuTypings::WriteGlobalTypings()
 	TSU_WRITELN("\tfunction setInterval(callback: () => void, interval: number): TimerHandle;");
 	TSU_WRITELN("\tfunction clearInterval(handle: TimerHandle): void;");
 	TSU_WRITELN("");
+	TSU_WRITELN("\tfunction batch<T extends object>(target: T, writes: (values: Partial<T>) => void): T;");
+	TSU_WRITELN("");
 	TSU_WRITELN("\tvar console: {");
 	TSU_WRITELN("\t\tlog(message: any, ...optionalParams: any[]): void;");
 	TSU_WRITELN("\t\tinfo(message: any, ...optionalParams: any[]): void;");
@@ -198,6 +546,23 @@ void FTsuTypings::WriteGlobalTypings()
 	TSU_WRITELN("\t\ttime(label: string): void;");
 	TSU_WRITELN("\t\ttimeEnd(label: string): void;");
 	TSU_WRITELN("\t}");
+	TSU_WRITELN("");
+	TSU_WRITELN("\tvar performance: {");
+	TSU_WRITELN("\t\tnow(): number;");
+	TSU_WRITELN("\t\tmark(name: string): void;");
+	TSU_WRITELN("\t\tmeasure(name: string, startMark?: string, endMark?: string): number;");
+	TSU_WRITELN("\t\tclearMarks(name?: string): void;");
+	TSU_WRITELN("\t}");
+	TSU_WRITELN("");
+	TSU_WRITELN("\tvar Struct: {");
+	TSU_WRITELN("\t\tserialize(value: object): ArrayBuffer;");
+	TSU_WRITELN("\t\tdeserialize<T>(type: new (...args: any[]) => T, buffer: ArrayBuffer | ArrayBufferView): T;");
+	TSU_WRITELN("\t}");
+	TSU_WRITELN("");
+	TSU_WRITELN("\tvar Json: {");
+	TSU_WRITELN("\t\tfromStruct(value: object): string;");
+	TSU_WRITELN("\t\ttoStruct<T>(type: new (...args: any[]) => T, text: string): T;");
+	TSU_WRITELN("\t}");
 	TSU_WRITELN("}");
 
 	SaveTypings(TEXT("TsuGlobals"), Output);
@@ -235,6 +600,30 @@ bool FTsuTypings::WriteTypings(UField* Type, const FTsuTypeSet& References)
 {
 	//const double TimeStart = FPlatformTime::Seconds();
 
+	const FString& Output = FormatTypings(Type, References);
+
+	//const double TimeEndWork = FPlatformTime::Seconds();
+
+	const FString TypeName = TailorNameOfType(Type);
+	if (!SaveTypings(TypeName, Output))
+		return false;
+
+	//const double TimeEndIo = FPlatformTime::Seconds();
+
+	//UE_LOG(
+	//	LogTsuRuntime,
+	//	Log,
+	//	TEXT("[%s] Generated typings in %.1f ms (%.1f ms work, %.1f ms I/O)"),
+	//	*TypeName,
+	//	(TimeEndIo - TimeStart) * 1000,
+	//	(TimeEndWork - TimeStart) * 1000,
+	//	(TimeEndIo - TimeEndWork) * 1000);
+
+	return true;
+}
+
+FString& FTsuTypings::FormatTypings(UField* Type, const FTsuTypeSet& References)
+{
 	FString& Output = ResetPersistentOutputBuffer();
 
 	TSU_WRITELN("// Generated file, any changes will be overwritten");
@@ -266,24 +655,7 @@ bool FTsuTypings::WriteTypings(UField* Type, const FTsuTypeSet& References)
 	else if (auto Struct = Cast<UStruct>(Type))
 		WriteObject(Output, Struct);
 
-	//const double TimeEndWork = FPlatformTime::Seconds();
-
-	const FString TypeName = TailorNameOfType(Type);
-	if (!SaveTypings(TypeName, Output))
-		return false;
-
-	//const double TimeEndIo = FPlatformTime::Seconds();
-
-	//UE_LOG(
-	//	LogTsuRuntime,
-	//	Log,
-	//	TEXT("[%s] Generated typings in %.1f ms (%.1f ms work, %.1f ms I/O)"),
-	//	*TypeName,
-	//	(TimeEndIo - TimeStart) * 1000,
-	//	(TimeEndWork - TimeStart) * 1000,
-	//	(TimeEndIo - TimeEndWork) * 1000);
-
-	return true;
+	return Output;
 }
 
 void FTsuTypings::WriteTypings(UField* Type)
@@ -310,6 +682,146 @@ void FTsuTypings::WriteDependencyTypings(UTsuBlueprintGeneratedClass* Class)
 	}
 }
 
+uint32 FTsuTypings::HashTypings(UField* Type, const FTsuTypeSet& References)
+{
+	uint32 Hash = TsuTypings_Private::TypingsVersion;
+
+	auto HashString = [&](const FString& String)
+	{
+		Hash = FCrc::StrCrc32(*String, Hash);
+	};
+
+	auto HashMetaData = [&](UObject* Object)
+	{
+#if WITH_EDITORONLY_DATA
+		if (const TMap<FName, FString>* MetaData = UMetaData::GetMapForObject(Object))
+		{
+			for (const auto& Entry : *MetaData)
+			{
+				HashString(Entry.Key.ToString());
+				HashString(Entry.Value);
+			}
+		}
+#endif // WITH_EDITORONLY_DATA
+	};
+
+	auto HashProperty = [&](UProperty* Property, bool bIsReadOnly)
+	{
+		HashString(TailorNameOfField(Property));
+		HashString(GetPropertyType(Property, bIsReadOnly));
+		Hash = HashCombine(Hash, GetTypeHash((uint64)Property->PropertyFlags));
+		HashMetaData(Property);
+	};
+
+	auto HashFunction = [&](UFunction* Function, const FString& FunctionName)
+	{
+		HashString(FunctionName);
+		Hash = HashCombine(Hash, GetTypeHash((uint32)Function->FunctionFlags));
+
+		for (UProperty* Parameter : FParamRange{Function})
+			HashProperty(Parameter, false);
+
+		HashMetaData(Function);
+	};
+
+	auto HashExtension = [&](UFunction* Function)
+	{
+		HashFunction(Function, TailorNameOfExtension(Function));
+	};
+
+	HashString(TailorNameOfType(Type));
+	HashMetaData(Type);
+
+	// The references only decide which imports get written, so their order doesn't matter
+	uint32 ReferencesHash = 0;
+	for (UField* Reference : References)
+		ReferencesHash ^= FCrc::StrCrc32(*TailorNameOfType(Reference));
+
+	Hash = HashCombine(Hash, ReferencesHash);
+
+	if (auto Enum = Cast<UEnum>(Type))
+	{
+		for (int32 Index = 0; Index < Enum->NumEnums(); ++Index)
+		{
+			HashString(Enum->GetNameStringByIndex(Index));
+			Hash = HashCombine(Hash, GetTypeHash(Enum->GetValueByIndex(Index)));
+		}
+	}
+	else if (auto Struct = Cast<UStruct>(Type))
+	{
+		if (UStruct* SuperStruct = Struct->GetSuperStruct())
+			HashString(TailorNameOfType(SuperStruct));
+
+		if (auto Class = Cast<UClass>(Struct))
+		{
+			Hash = HashCombine(Hash, GetTypeHash((uint32)(Class->ClassFlags & CLASS_Abstract)));
+
+			for (FImplementedInterface& Interface : Class->Interfaces)
+				HashString(TailorNameOfType(Interface.Class));
+		}
+
+		FTsuReflection::VisitProperties(HashProperty, Struct);
+
+		FTsuReflection::VisitMethods([&](UFunction* Function)
+		{
+			HashFunction(Function, TailorNameOfField(Function));
+		}, Struct);
+
+		FTsuReflection::VisitExtensionConstants(HashExtension, Struct);
+		FTsuReflection::VisitExtensionMethods(HashExtension, Struct);
+		FTsuReflection::VisitStaticExtensionMethods(HashExtension, Struct);
+
+		if (UFunction* MakeFunction = FTsuReflection::FindMakeFunction(Struct))
+			HashFunction(MakeFunction, MakeFunction->GetName());
+	}
+
+	return Hash;
+}
+
+TMap<FString, uint32> FTsuTypings::LoadTypingsManifest()
+{
+	TMap<FString, uint32> Manifest;
+
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *TsuTypings_Private::GetTypingsManifestPath()))
+		return Manifest;
+
+	TSharedPtr<FJsonObject> Root;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root) || !Root.IsValid())
+		return Manifest;
+
+	const TSharedPtr<FJsonObject>* Types = nullptr;
+	if (!Root->TryGetObjectField(TEXT("types"), Types))
+		return Manifest;
+
+	Manifest.Reserve((*Types)->Values.Num());
+
+	for (const auto& Entry : (*Types)->Values)
+		Manifest.Add(Entry.Key, (uint32)FCString::Strtoui64(*Entry.Value->AsString(), nullptr, 16));
+
+	return Manifest;
+}
+
+void FTsuTypings::SaveTypingsManifest(const TMap<FString, uint32>& Manifest)
+{
+	FString Json;
+
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	Writer->WriteObjectStart();
+
+	Writer->WriteObjectStart(TEXT("types"));
+	for (const auto& Entry : Manifest)
+		Writer->WriteValue(Entry.Key, FString::Printf(TEXT("%08x"), Entry.Value));
+	Writer->WriteObjectEnd();
+
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	const FString ManifestPath = TsuTypings_Private::GetTypingsManifestPath();
+	if (!FFileHelper::SaveStringToFile(Json, *ManifestPath))
+		UE_LOG(LogTsuRuntime, Warning, TEXT("Failed to save typings manifest to '%s'"), *ManifestPath);
+}
+
 bool FTsuTypings::DoTypingsExist(UField* Type)
 {
 	return DoTypingsExist(*TailorNameOfType(Type));
@@ -412,7 +924,7 @@ void FTsuTypings::WriteObject(FString& Output, UStruct* Struct)
 
 	FTsuReflection::VisitExtensionConstants([&](UFunction* Function)
 	{
-		WriteStaticExtensionMethod(Output, Function);
+		WriteConstant(Output, Function);
 	}, Struct);
 
 	FTsuReflection::VisitMethods([&](UFunction* Function)
@@ -609,6 +1121,15 @@ void FTsuTypings::WriteStaticExtensionMethod(FString& Output, UFunction* Functio
 	TSU_WRITELN("");
 }
 
+void FTsuTypings::WriteConstant(FString& Output, UFunction* Function)
+{
+	WriteToolTip(Output, Function, false, true);
+	TSU_WRITEF("\tstatic readonly %s: ", *TailorNameOfExtension(Function));
+	WriteReturns(Output, Function);
+	TSU_WRITELN(";");
+	TSU_WRITELN("");
+}
+
 void FTsuTypings::WriteParameters(FString& Output, UFunction* Function, bool bSkipFirst)
 {
 	bool bIsRestOptional = FTsuReflection::IsK2Method(Function);
@@ -692,7 +1213,11 @@ bool FTsuTypings::SaveTypings(const FString& TypeName, const FString& Output)
 	if (Output.Equals(ExistingOutput, ESearchCase::CaseSensitive))
 		return true;
 
-	if (!FFileHelper::SaveStringToFile(Output, *OutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	// Written to the side and moved into place, so the language service never sees half of a file
+	const FString TempPath = OutputPath + TEXT(".tmp");
+
+	if (!FFileHelper::SaveStringToFile(Output, *TempPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM) ||
+		!IFileManager::Get().Move(*OutputPath, *TempPath, true))
 	{
 		UE_LOG(LogTsuRuntime, Error, TEXT("[%s] Failed to save typings"), *TypeName);
 		return false;
@@ -792,7 +1317,8 @@ FString FTsuTypings::GetPropertyType(UProperty* Property, bool bIsReadOnly)
 	}
 	else if (auto DelegateProperty = Cast<UDelegateProperty>(Property))
 	{
-		if (FTsuReflection::IsInputParameter(DelegateProperty))
+		// Only delegates of UObjects are referenced, anything else is copied into a function, see CopyDelegate
+		if (!DelegateProperty->GetOuter()->IsA<UClass>())
 		{
 			Result = TEXT("(");
 
@@ -818,7 +1344,7 @@ FString FTsuTypings::GetPropertyType(UProperty* Property, bool bIsReadOnly)
 	}
 	else if (auto MulticastDelegateProperty = Cast<UMulticastDelegateProperty>(Property))
 	{
-		if (FTsuReflection::IsInputParameter(MulticastDelegateProperty))
+		if (!MulticastDelegateProperty->GetOuter()->IsA<UClass>())
 		{
 			Result = TEXT("(");
 
@@ -1052,20 +1578,9 @@ FString& FTsuTypings::TrimRedundancy(FString& Name, const FString& ParentName)
 
 const FString& FTsuTypings::TailorNameOfType(UField* Type)
 {
-	using FCachedName = TPair<FName, FString>;
-	using FCache = TMap<UField*, FCachedName>;
+	static TsuTypings_Private::TNameCache<const UField*> Cache{6'000};
 
-	static FCache Cache = []
-	{
-		FCache Result;
-		Result.Reserve(6'000);
-		return Result;
-	}();
-
-	const FName TypeFName = Type->GetFName();
-
-	FCachedName& CachedName = Cache.FindOrAdd(Type);
-	if (CachedName.Key != TypeFName)
+	return Cache.FindOrAdd(Type, Type->GetFName(), [&]
 	{
 		FString TypeName;
 
@@ -1086,10 +1601,8 @@ const FString& FTsuTypings::TailorNameOfType(UField* Type)
 		if (TypeName.IsEmpty())
 			TypeName = Type->GetName();
 
-		CachedName = FCachedName(TypeFName, MoveTemp(TypeName));
-	}
-	
-	return CachedName.Value;
+		return TypeName;
+	});
 }
 
 FString& FTsuTypings::TailorNameOfField(FString& Name)
@@ -1119,50 +1632,22 @@ FString FTsuTypings::TailorNameOfField(FString&& InName)
 
 const FString& FTsuTypings::TailorNameOfField(UField* Field)
 {
-	using FCachedName = TPair<FName, FString>;
-	using FCache = TMap<const UField*, FCachedName>;
-
-	static FCache Cache = []
-	{
-		FCache Result;
-		Result.Reserve(25'000);
-		return Result;
-	}();
-
-	FName FieldFName = Field->GetFName();
+	static TsuTypings_Private::TNameCache<const UField*> Cache{25'000};
 
-	FCachedName& CachedName = Cache.FindOrAdd(Field);
-	if (CachedName.Key != FieldFName)
+	return Cache.FindOrAdd(Field, Field->GetFName(), [&]
 	{
-		FString FieldName;
-
 		if (TOptional<FString> ScriptName = GetExplicitScriptName(Field))
-			FieldName = CamelCase(MoveTemp(ScriptName.GetValue()));
+			return CamelCase(MoveTemp(ScriptName.GetValue()));
 		else
-			FieldName = TailorNameOfField(Field->GetName());
-
-		CachedName = FCachedName(FieldFName, MoveTemp(FieldName));
-	}
-
-	return CachedName.Value;
+			return TailorNameOfField(Field->GetName());
+	});
 }
 
 const FString& FTsuTypings::TailorNameOfExtension(UFunction* Function)
 {
-	using FCachedName = TPair<FName, FString>;
-	using FCache = TMap<const UFunction*, FCachedName>;
-
-	static FCache Cache = []
-	{
-		FCache Result;
-		Result.Reserve(1'000);
-		return Result;
-	}();
+	static TsuTypings_Private::TNameCache<const UFunction*> Cache{1'000};
 
-	const FName FunctionFName = Function->GetFName();
-
-	FCachedName& CachedName = Cache.FindOrAdd(Function);
-	if (CachedName.Key != FunctionFName)
+	return Cache.FindOrAdd(Function, Function->GetFName(), [&]
 	{
 		FString FunctionName;
 
@@ -1189,8 +1674,6 @@ const FString& FTsuTypings::TailorNameOfExtension(UFunction* Function)
 			TailorNameOfField(FunctionName);
 		}
 
-		CachedName = FCachedName(FunctionFName, MoveTemp(FunctionName));
-	}
-
-	return CachedName.Value;
+		return FunctionName;
+	});
 }
@@ -0,0 +1,181 @@
+#include "TsuV8Allocator.h"
+
+#include "HAL/PlatformMemory.h"
+#include "Misc/ScopeLock.h"
+
+FTsuV8Allocator::~FTsuV8Allocator()
+{
+	Trim();
+}
+
+void* FTsuV8Allocator::Allocate(size_t Length)
+{
+	const int32 BucketIndex = GetBucketIndex(Length);
+	if (BucketIndex == INDEX_NONE)
+	{
+		// Pages fresh from the OS are already zeroed, so there's no need to clear them ourselves
+		return AllocateLarge(Length);
+	}
+
+	void* Data = AllocateFromBucket(BucketIndex);
+	if (Data)
+	{
+		FMemory::Memzero(Data, Length);
+		TrackAllocation(Length);
+	}
+
+	return Data;
+}
+
+void* FTsuV8Allocator::AllocateUninitialized(size_t Length)
+{
+	const int32 BucketIndex = GetBucketIndex(Length);
+	if (BucketIndex == INDEX_NONE)
+		return AllocateLarge(Length);
+
+	void* Data = AllocateFromBucket(BucketIndex);
+	if (Data)
+		TrackAllocation(Length);
+
+	return Data;
+}
+
+void FTsuV8Allocator::Free(void* Data, size_t Length)
+{
+	if (!Data)
+		return;
+
+	LiveBytes -= (int64)Length;
+
+	const int32 BucketIndex = GetBucketIndex(Length);
+	if (BucketIndex == INDEX_NONE)
+	{
+		LargeBytes -= (int64)Length;
+		--NumLarge;
+		FPlatformMemory::BinnedFreeToOS(Data, Length);
+		return;
+	}
+
+	FBucket& Bucket = Buckets[BucketIndex];
+	--Bucket.NumLive;
+
+	const SIZE_T BucketSize = GetBucketSize(BucketIndex);
+
+	{
+		FScopeLock Lock(&Bucket.Mutex);
+
+		if ((SIZE_T)Bucket.FreeList.Num() * BucketSize < MaxPooledBytesPerBucket)
+		{
+			Bucket.FreeList.Add(Data);
+			PooledBytes += (int64)BucketSize;
+			return;
+		}
+	}
+
+	FMemory::Free(Data);
+}
+
+void FTsuV8Allocator::Trim()
+{
+	for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+	{
+		FBucket& Bucket = Buckets[BucketIndex];
+		TArray<void*> FreeList;
+
+		{
+			FScopeLock Lock(&Bucket.Mutex);
+			Swap(FreeList, Bucket.FreeList);
+		}
+
+		for (void* Data : FreeList)
+			FMemory::Free(Data);
+
+		PooledBytes -= (int64)(FreeList.Num() * GetBucketSize(BucketIndex));
+	}
+}
+
+FTsuV8Allocator::FStats FTsuV8Allocator::GetStats() const
+{
+	FStats Stats;
+	Stats.LiveBytes = LiveBytes;
+	Stats.PeakBytes = PeakBytes;
+	Stats.PooledBytes = PooledBytes;
+	Stats.LargeBytes = LargeBytes;
+	Stats.NumLarge = NumLarge;
+
+	for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+	{
+		const FBucket& Bucket = Buckets[BucketIndex];
+		FBucketStats& BucketStats = Stats.Buckets[BucketIndex];
+		BucketStats.BucketSize = GetBucketSize(BucketIndex);
+		BucketStats.NumAllocations = Bucket.NumAllocations;
+		BucketStats.NumLive = Bucket.NumLive;
+
+		FScopeLock Lock(&Bucket.Mutex);
+		BucketStats.NumPooled = Bucket.FreeList.Num();
+	}
+
+	return Stats;
+}
+
+int32 FTsuV8Allocator::GetBucketIndex(size_t Length)
+{
+	if (Length <= MinBucketSize)
+		return 0;
+
+	const int32 BucketIndex = (int32)FMath::CeilLogTwo64(Length) - (int32)FMath::CeilLogTwo64(MinBucketSize);
+	return BucketIndex < NumBuckets ? BucketIndex : INDEX_NONE;
+}
+
+SIZE_T FTsuV8Allocator::GetBucketSize(int32 BucketIndex)
+{
+	return MinBucketSize << BucketIndex;
+}
+
+void* FTsuV8Allocator::AllocateFromBucket(int32 BucketIndex)
+{
+	FBucket& Bucket = Buckets[BucketIndex];
+	++Bucket.NumAllocations;
+	++Bucket.NumLive;
+
+	const SIZE_T BucketSize = GetBucketSize(BucketIndex);
+
+	{
+		FScopeLock Lock(&Bucket.Mutex);
+
+		if (Bucket.FreeList.Num() > 0)
+		{
+			PooledBytes -= (int64)BucketSize;
+			return Bucket.FreeList.Pop(/*bAllowShrinking=*/false);
+		}
+	}
+
+	void* Data = FMemory::Malloc(BucketSize, sizeof(void*));
+	if (!Data)
+		--Bucket.NumLive;
+
+	return Data;
+}
+
+void* FTsuV8Allocator::AllocateLarge(size_t Length)
+{
+	void* Data = FPlatformMemory::BinnedAllocFromOS(Length);
+	if (Data)
+	{
+		LargeBytes += (int64)Length;
+		++NumLarge;
+		TrackAllocation(Length);
+	}
+
+	return Data;
+}
+
+void FTsuV8Allocator::TrackAllocation(size_t Length)
+{
+	const int64 NewLiveBytes = (LiveBytes += (int64)Length);
+
+	int64 OldPeakBytes = PeakBytes;
+	while (NewLiveBytes > OldPeakBytes && !PeakBytes.compare_exchange_weak(OldPeakBytes, NewLiveBytes))
+	{
+	}
+}
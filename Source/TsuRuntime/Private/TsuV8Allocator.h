@@ -0,0 +1,76 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "TsuV8Wrapper.h"
+
+#include "HAL/CriticalSection.h"
+
+#include <atomic>
+
+/** ArrayBuffer allocator that pools small buffers in power-of-two size buckets */
+class FTsuV8Allocator final
+	: public v8::ArrayBuffer::Allocator
+{
+public:
+	/** The size of the smallest bucket, in bytes */
+	static constexpr SIZE_T MinBucketSize = 16;
+
+	/** The number of buckets, which puts the largest one at 64 KiB */
+	static constexpr int32 NumBuckets = 13;
+
+	/** The most memory each bucket is allowed to keep around once its buffers are freed, in bytes */
+	static constexpr SIZE_T MaxPooledBytesPerBucket = 1024 * 1024;
+
+	struct FBucketStats
+	{
+		SIZE_T BucketSize = 0;
+		int64 NumAllocations = 0;
+		int64 NumLive = 0;
+		int64 NumPooled = 0;
+	};
+
+	struct FStats
+	{
+		int64 LiveBytes = 0;
+		int64 PeakBytes = 0;
+		int64 PooledBytes = 0;
+		int64 LargeBytes = 0;
+		int64 NumLarge = 0;
+		FBucketStats Buckets[NumBuckets];
+	};
+
+	~FTsuV8Allocator();
+
+	void* Allocate(size_t Length) override;
+	void* AllocateUninitialized(size_t Length) override;
+	void Free(void* Data, size_t Length) override;
+
+	/** Returns all pooled buffers to the system */
+	void Trim();
+
+	FStats GetStats() const;
+
+private:
+	struct FBucket
+	{
+		mutable FCriticalSection Mutex;
+		TArray<void*> FreeList;
+		std::atomic<int64> NumAllocations{0};
+		std::atomic<int64> NumLive{0};
+	};
+
+	static int32 GetBucketIndex(size_t Length);
+	static SIZE_T GetBucketSize(int32 BucketIndex);
+
+	void* AllocateFromBucket(int32 BucketIndex);
+	void* AllocateLarge(size_t Length);
+	void TrackAllocation(size_t Length);
+
+	FBucket Buckets[NumBuckets];
+	std::atomic<int64> LiveBytes{0};
+	std::atomic<int64> PeakBytes{0};
+	std::atomic<int64> PooledBytes{0};
+	std::atomic<int64> LargeBytes{0};
+	std::atomic<int64> NumLarge{0};
+};
@@ -9,6 +9,7 @@
 
 #include "UObject/GCObject.h"
 #include "UObject/Stack.h"
+#include "UObject/StructOnScope.h"
 #include "UObject/WeakObjectPtrTemplates.h"
 
 class TSURUNTIME_API FTsuContext final
@@ -18,11 +19,37 @@ class TSURUNTIME_API FTsuContext final
 	friend class FTsuModule;
 	friend struct FTsuWorldContextScope;
 	friend class UTsuDelegateEvent;
+	friend class FTsuProfiler;
+	friend class FTsuNativeCalls;
 
 	using FStructKey = TTuple<void*, UScriptStruct*>;
 	using FDelegateKey = TTuple<UObject*, UProperty*>;
+	using FDelegateCopyKey = TTuple<void*, UProperty*>;
+	using FConsoleMessageKey = TPair<ELogVerbosity::Type, FString>;
 	using FDelegateEventMap = TMap<FWeakObjectPtr, TMap<uint64, UTsuDelegateEvent*>>;
 
+	struct FPerformanceEntry
+	{
+		FString Name;
+		double StartTime;
+		double Duration;
+		bool bIsMeasure;
+	};
+
+	struct FInvokeErrors
+	{
+		int32 NumConsecutive = 0;
+		uint64 FirstErrorFrame = 0;
+	};
+
+	/** The shape of the object that a function with output parameters returns, see GetReturnTemplate */
+	struct FReturnTemplate
+	{
+		v8::Global<v8::ObjectTemplate> Template;
+		TArray<UProperty*> Returns;
+		TArray<v8::Global<v8::String>> Names;
+	};
+
 	static const FName MetaWorldContext;
 	static const FName NameEventExecute;
 
@@ -182,9 +209,29 @@ private:
 	 */
 	v8::Local<v8::Object> ReferenceDelegate(UProperty* ParentProperty, UObject* Parent);
 
+	/**
+	 * Creates a V8 function that calls a copy of a regular or multicast delegate, for delegates that are passed by
+	 * value and have no parent UObject to reference.
+	 *
+	 * @param DelegateProperty The delegate property describing the value
+	 * @param Buffer Pointer to the delegate value
+	 * @returns The resulting V8 function
+	 */
+	v8::Local<v8::Function> CopyDelegate(UProperty* DelegateProperty, const void* Buffer);
+
 	/** The native function callback for exported TSU functions */
 	void Invoke(const TCHAR* Namespace, FFrame& Stack, RESULT_DECL);
 
+	/**
+	 * Keeps track of how many times in a row a function has thrown, and disables it once it's thrown
+	 * too many times within too few frames.
+	 *
+	 * @see UTsuRuntimeSettings::MaxConsecutiveInvokeErrors
+	 * @param Binding The name of the module that the function was exported from
+	 * @param Function The function that threw
+	 */
+	void HandleInvokeError(const TCHAR* Binding, UFunction* Function);
+
 	/**
 	 * Callback for UTsuDelegateEvent when a delegate event is called/broadcast.
 	 * 
@@ -209,6 +256,13 @@ private:
 	/** Callback for post UObject GC */
 	void OnPostGarbageCollect();
 
+	/** Callback for post V8 GC, only called for full collections */
+	static void OnPostGarbageCollectV8(
+		v8::Isolate* Isolate,
+		v8::GCType Type,
+		v8::GCCallbackFlags Flags,
+		void* Data);
+
 	/**
 	 * Creates and stores a callback to be invoked after a specified delay, using `FTimerManager`.
 	 * 
@@ -219,6 +273,19 @@ private:
 	 */
 	v8::Local<v8::Value> StartTimeout(v8::Local<v8::Function> Callback, float Delay, bool bLoop);
 
+	/**
+	 * Writes the arguments of a `console` call to the log, or queues it up for the end of the frame if batching is
+	 * enabled and it's neither a warning nor an error. Does nothing, not even converting the arguments, if the
+	 * verbosity is suppressed.
+	 */
+	void LogConsoleMessage(
+		const v8::FunctionCallbackInfo<v8::Value>& Info,
+		ELogVerbosity::Type Verbosity,
+		bool bWithCallSite);
+
+	/** Writes all queued console messages to the log */
+	void FlushConsoleMessages();
+
 	/** ... */
 	TSU_CONTEXT_CALLBACK(OnConsoleLog);
 
@@ -234,6 +301,21 @@ private:
 	/** ... */
 	TSU_CONTEXT_CALLBACK(OnConsoleTrace);
 
+	/** ... */
+	TSU_CONTEXT_CALLBACK(OnPerformanceNow);
+
+	/** ... */
+	TSU_CONTEXT_CALLBACK(OnPerformanceMark);
+
+	/** ... */
+	TSU_CONTEXT_CALLBACK(OnPerformanceMeasure);
+
+	/** Forgets the mark of the given name, or every mark when no name is given, like `performance.clearMarks` */
+	TSU_CONTEXT_CALLBACK(OnPerformanceClearMarks);
+
+	/** Records a mark or measure in the performance ring buffer, overwriting the oldest entry once it's full */
+	void AddPerformanceEntry(const FString& Name, double StartTime, double Duration, bool bIsMeasure);
+
 	/** ... */
 	TSU_CONTEXT_CALLBACK(OnClassNew);
 
@@ -249,17 +331,32 @@ private:
 	/** ... */
 	TSU_CONTEXT_CALLBACK(OnCallExtensionMethod);
 
+	/**
+	 * Evaluates a script constant the first time it's accessed. V8 then replaces the accessor with a read-only data
+	 * property holding the result, so every subsequent access is a plain property load.
+	 */
+	TSU_CONTEXT_GETTER(OnGetConstant);
+
 	/** ... */
 	TSU_CONTEXT_CALLBACK(OnConsoleTimeBegin);
 
 	/** ... */
 	TSU_CONTEXT_CALLBACK(OnConsoleTimeEnd);
 
-	/** ... */
-	TSU_CONTEXT_CALLBACK(OnPropertyGet);
+	/** Gets a property through the stub generated for it, see FTsuStaticBindings */
+	TSU_CONTEXT_GETTER(OnStaticPropertyGet);
 
-	/** ... */
-	TSU_CONTEXT_CALLBACK(OnPropertySet);
+	/** Sets a property through the stub generated for it, see FTsuStaticBindings */
+	TSU_CONTEXT_SETTER(OnStaticPropertySet);
+
+	/**
+	 * Gets a property through reflection. Properties are registered as native accessors rather than accessor
+	 * functions, so V8 can call these straight from its inline caches without setting up a function call.
+	 */
+	TSU_CONTEXT_GETTER(OnPropertyGet);
+
+	/** Sets a property through reflection, see OnPropertyGet */
+	TSU_CONTEXT_SETTER(OnPropertySet);
 
 	/** ... */
 	TSU_CONTEXT_CALLBACK(OnGetArrayElement);
@@ -303,12 +400,36 @@ private:
 	/** ... */
 	TSU_CONTEXT_CALLBACK(OnImport);
 
+	/**
+	 * Calls a function with an empty object to assign property values to, then writes all of them to the target
+	 * in one go. Struct proxies only get copied out and written back once, rather than for every property.
+	 */
+	TSU_CONTEXT_CALLBACK(OnBatch);
+
+	/** Gets the properties of a type that can be written by name, including inherited ones, see OnBatch */
+	const TMap<FString, UProperty*>& GetWritableProperties(UStruct* Type);
+
 	/** ... */
 	TSU_CONTEXT_CALLBACK(OnGetProperty);
 
 	/** ... */
 	TSU_CONTEXT_CALLBACK(OnSetProperty);
 
+	/**
+	 * Serializes a struct to an ArrayBuffer through tagged property serialization, with names and object
+	 * references written as strings, so the result survives both restarts and changes to the struct.
+	 */
+	TSU_CONTEXT_CALLBACK(OnStructSerialize);
+
+	/** Creates a struct of a given type from what OnStructSerialize produced */
+	TSU_CONTEXT_CALLBACK(OnStructDeserialize);
+
+	/** Converts a struct or object to a JSON string natively, see FJsonObjectConverter */
+	TSU_CONTEXT_CALLBACK(OnJsonFromStruct);
+
+	/** Parses a JSON string straight into a new struct of a given type */
+	TSU_CONTEXT_CALLBACK(OnJsonToStruct);
+
 	/** ... */
 	TSU_CONTEXT_CALLBACK(OnGetStaticClass);
 
@@ -336,6 +457,15 @@ private:
 	/** ... */
 	TSU_CONTEXT_CALLBACK(OnMulticastDelegateIsBound);
 
+	/** Calls a delegate copied by CopyDelegate, which is passed as the data of the function */
+	TSU_CONTEXT_CALLBACK(OnDelegateCopyCall);
+
+	/**
+	 * Gets the template for the objects returned by a function with output parameters, which has every output
+	 * declared up front so that each result starts out with the same hidden class.
+	 */
+	const FReturnTemplate& GetReturnTemplate(UFunction* Method);
+
 	/** ... */
 	void CallMethod(
 		UObject* Object,
@@ -343,6 +473,12 @@ private:
 		void* ParamsBuffer,
 		v8::ReturnValue<v8::Value> ReturnValue);
 
+	/** Reads the return value and output parameters of a function that has been called into the return value of a callback */
+	void ReadReturnValues(
+		UFunction* Method,
+		void* ParamsBuffer,
+		v8::ReturnValue<v8::Value> ReturnValue);
+
 	/** ... */
 	void WriteParameters(
 		const v8::FunctionCallbackInfo<v8::Value>& Info,
@@ -412,6 +548,9 @@ private:
 	/** ... */
 	bool ValuesToString(const TArray<v8::Local<v8::Value>>& Values, FString& OutResult);
 
+	/** Appends the arguments of a call to a string, separated by spaces, without going through temporaries */
+	void AppendArgsToString(const v8::FunctionCallbackInfo<v8::Value>& Info, int32 Begin, FString& OutResult);
+
 	/** ... */
 	bool EnsureV8(bool bCondition, const TCHAR* Expression);
 
@@ -436,6 +575,9 @@ private:
 		FString& OutFunctionName,
 		int32& OutLineNumber);
 
+	/** Gets the name of a function along with where it was defined, for use in profiling */
+	FString GetFunctionDisplayName(v8::Local<v8::Function> Function);
+
 	/** ... */
 	v8::Local<v8::Value> UnwrapStructProxy(const v8::Local<v8::Value>& Info);
 
@@ -451,6 +593,9 @@ private:
 	/** ... */
 	v8::Global<v8::FunctionTemplate> GlobalMulticastDelegateTemplate;
 
+	/** Template for the data of the functions returned by CopyDelegate */
+	v8::Global<v8::ObjectTemplate> GlobalDelegateCopyTemplate;
+
 	/** ... */
 	v8::Global<v8::Function> GlobalArrayHandlerConstructor;
 
@@ -478,9 +623,45 @@ private:
 	/** ... */
 	TMap<FString, uint64> PendingTimeLogs;
 
+	/** The time of the latest mark of each name, in seconds since the time origin, capped by dropping the oldest marks */
+	TMap<FString, double> PerformanceMarks;
+
+	/** Ring buffer of recent marks and measures */
+	TArray<FPerformanceEntry> PerformanceEntries;
+
+	/** Where in the ring buffer the oldest entry is */
+	int32 NextPerformanceEntry = 0;
+
+	/** Console messages waiting for the end of the frame, along with how many times each was logged */
+	TMap<FConsoleMessageKey, int32> PendingConsoleMessages;
+
+	/** Reused between console calls so that repeated messages don't allocate */
+	FString ConsoleMessageBuffer;
+
+	/** Script functions bound to Blueprint that have recently thrown, see HandleInvokeError */
+	TMap<UFunction*, FInvokeErrors> InvokeErrors;
+
+	/** Script functions bound to Blueprint that threw too many times in a row to keep calling */
+	TSet<UFunction*> DisabledFunctions;
+
+	/** ... */
+	FDelegateHandle HandleEndFrame;
+
+	/** When the context was created, which is what `performance.now` is relative to, in seconds */
+	double TimeOrigin = 0.0;
+
 	/** ... */
 	TMap<UStruct*, v8::Global<v8::FunctionTemplate>> Templates;
 
+	/** The writable properties of each type by their names in script, see GetWritableProperties */
+	TMap<UStruct*, TMap<FString, UProperty*>> WritableProperties;
+
+	/** Result object templates for functions with output parameters, see GetReturnTemplate */
+	TMap<UFunction*, FReturnTemplate> ReturnTemplates;
+
+	/** The values of script constants that return structs, which are copied out on access, see OnGetConstant */
+	TMap<UFunction*, TSharedPtr<FStructOnScope>> ConstantStructs;
+
 	/** ... */
 	TMap<FStructKey, v8::Global<v8::Object>> AliveStructs;
 
@@ -490,9 +671,21 @@ private:
 	/** ... */
 	TMap<FDelegateKey, v8::Global<v8::Object>> AliveDelegates;
 
+	/** Delegates copied by CopyDelegate, which are freed once their function is collected */
+	TMap<FDelegateCopyKey, v8::Global<v8::Object>> AliveDelegateCopies;
+
 	/** ... */
 	TArray<FTsuTimer> AliveTimers;
 
+	/** The number of full V8 GCs that had happened when each alive object, struct and delegate was referenced */
+	TMap<const void*, uint32> WrapperGenerations;
+
+	/** The number of full V8 GCs so far */
+	uint32 NumGarbageCollections = 0;
+
+	/** Weak handles to the exports of every evaluated module, keyed by path */
+	TMap<FString, v8::Global<v8::Value>> ModuleExports;
+
 	/** ... */
 	void *Inspector;
 };
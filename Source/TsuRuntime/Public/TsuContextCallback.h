@@ -1,8 +1,25 @@
 #pragma once
 
-#define TSU_CONTEXT_CALLBACK(FunctionName)                                               \
-	void FunctionName(const v8::FunctionCallbackInfo<v8::Value>& Info);          \
-	static void _##FunctionName(const v8::FunctionCallbackInfo<v8::Value>& Info) \
-	{                                                                            \
-		Singleton->FunctionName(Info);                                           \
+#include "TsuRuntimeStats.h"
+
+#define TSU_CONTEXT_CALLBACK(FunctionName)                                                       \
+	void FunctionName(const v8::FunctionCallbackInfo<v8::Value>& Info);                          \
+	static void _##FunctionName(const v8::FunctionCallbackInfo<v8::Value>& Info)                 \
+	{                                                                                            \
+		DECLARE_SCOPE_CYCLE_COUNTER(TEXT(#FunctionName), STAT_Tsu##FunctionName, STATGROUP_Tsu); \
+		Singleton->FunctionName(Info);                                                           \
+	}
+#define TSU_CONTEXT_GETTER(FunctionName)                                                                           \
+	void FunctionName(v8::Local<v8::Name> Name, const v8::PropertyCallbackInfo<v8::Value>& Info);                  \
+	static void _##FunctionName(v8::Local<v8::Name> Name, const v8::PropertyCallbackInfo<v8::Value>& Info)         \
+	{                                                                                                              \
+		DECLARE_SCOPE_CYCLE_COUNTER(TEXT(#FunctionName), STAT_Tsu##FunctionName, STATGROUP_Tsu);                   \
+		Singleton->FunctionName(Name, Info);                                                                       \
+	}
+#define TSU_CONTEXT_SETTER(FunctionName)                                                                                                     \
+	void FunctionName(v8::Local<v8::Name> Name, v8::Local<v8::Value> Value, const v8::PropertyCallbackInfo<void>& Info);                     \
+	static void _##FunctionName(v8::Local<v8::Name> Name, v8::Local<v8::Value> Value, const v8::PropertyCallbackInfo<void>& Info)            \
+	{                                                                                                                                        \
+		DECLARE_SCOPE_CYCLE_COUNTER(TEXT(#FunctionName), STAT_Tsu##FunctionName, STATGROUP_Tsu);                                             \
+		Singleton->FunctionName(Name, Value, Info);                                                                                          \
 	}
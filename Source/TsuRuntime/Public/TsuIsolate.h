@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "TsuV8Wrapper.h"
 
+class FTsuHeapStats;
 class FTsuRuntimeModule;
 
 class TSURUNTIME_API FTsuIsolate
@@ -15,8 +16,21 @@ protected:
 public:
 	static v8::Isolate* Get() { return Isolate; }
 	static v8::Platform* GetPlatform() { return Platform.get(); }
+	static const FTsuHeapStats* GetHeapStats();
 
 private:
+	static void ConfigureHeap(v8::ResourceConstraints& Constraints);
+	static void OnBeginFrame();
+	static void OnEndFrame();
+	static void OnMemoryTrim();
+	static size_t OnNearHeapLimit(void* Data, size_t CurrentHeapLimit, size_t InitialHeapLimit);
+
 	static v8::Isolate* Isolate;
 	static std::unique_ptr<v8::Platform> Platform;
+	static double FrameStartTime;
+	static bool bIsUnderMemoryPressure;
+	static bool bIsNearHeapLimit;
+	static FDelegateHandle HandleBeginFrame;
+	static FDelegateHandle HandleEndFrame;
+	static FDelegateHandle HandleMemoryTrim;
 };
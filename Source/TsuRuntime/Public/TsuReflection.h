@@ -6,6 +6,8 @@ using FTsuTypeSet = TSet<UField*>;
 
 class TSURUNTIME_API FTsuReflection
 {
+	friend class FTsuExtensionIndex;
+
 	static const FName MetaWorldContext;
 	static const FName MetaNativeMakeFunc;
 	static const FName MetaNativeBreakFunc;
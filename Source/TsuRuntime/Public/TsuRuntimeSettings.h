@@ -14,6 +14,66 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category="Runtime", Meta=(ConfigRestartRequired=true))
 	bool bAllowCodeGenerationFromStrings = false;
 
+	/** The initial size of the V8 heap, in megabytes (0 uses the V8 default) */
+	UPROPERTY(EditAnywhere, Config, Category="Memory", Meta=(ConfigRestartRequired=true, ClampMin=0))
+	int32 InitialHeapSizeMB = 0;
+
+	/** The maximum size of the V8 heap, in megabytes (0 uses the V8 default) */
+	UPROPERTY(EditAnywhere, Config, Category="Memory", Meta=(ConfigRestartRequired=true, ClampMin=0))
+	int32 MaxHeapSizeMB = 0;
+
+	/** The maximum size of the young generation of the V8 heap, in megabytes (0 uses the V8 default) */
+	UPROPERTY(EditAnywhere, Config, Category="Memory", Meta=(ConfigRestartRequired=true, ClampMin=0))
+	int32 MaxYoungGenerationSizeMB = 0;
+
+	/** How much the heap limit is temporarily raised by when scripts are about to run out of memory, in megabytes */
+	UPROPERTY(EditAnywhere, Config, Category="Memory", Meta=(ConfigRestartRequired=true, ClampMin=1))
+	int32 NearHeapLimitHeadroomMB = 16;
+
+	/** How full the heap can get, as a fraction of its limit, before V8 is notified of memory pressure */
+	UPROPERTY(EditAnywhere, Config, Category="Memory", Meta=(ClampMin=0, ClampMax=1))
+	float MemoryPressureThreshold = 0.8f;
+
+	/** Whether or not to let V8 do garbage collection in whatever time is left at the end of each frame */
+	UPROPERTY(EditAnywhere, Config, Category="Memory")
+	bool bIdleGarbageCollection = true;
+
+	/** The frame time that idle garbage collection is allowed to fill up, in milliseconds */
+	UPROPERTY(EditAnywhere, Config, Category="Memory", Meta=(ClampMin=1, EditCondition="bIdleGarbageCollection"))
+	float IdleFrameBudgetMs = 16.6f;
+
+	/** The least amount of leftover frame time worth handing to V8, in milliseconds */
+	UPROPERTY(EditAnywhere, Config, Category="Memory", Meta=(ClampMin=0, EditCondition="bIdleGarbageCollection"))
+	float MinIdleTimeMs = 1.f;
+
+	/** Whether or not to prefix `console.log` messages with the script and line they came from, which means capturing a stack trace */
+	UPROPERTY(EditAnywhere, Config, Category="Logging")
+	bool bLogCallSite = false;
+
+	/** Whether or not to prefix `console.warn` messages with the script and line they came from, which means capturing a stack trace */
+	UPROPERTY(EditAnywhere, Config, Category="Logging")
+	bool bWarningCallSite = false;
+
+	/** Whether or not to prefix `console.error` messages with the script and line they came from, which means capturing a stack trace */
+	UPROPERTY(EditAnywhere, Config, Category="Logging")
+	bool bErrorCallSite = false;
+
+	/** Whether or not to collapse identical `console.log` messages into a single log entry at the end of each frame, warnings and errors are always logged right away */
+	UPROPERTY(EditAnywhere, Config, Category="Logging")
+	bool bBatchConsoleMessages = false;
+
+	/** How often an exception thrown from the same location gets logged with its stack trace, in seconds, with repeats in between only being counted */
+	UPROPERTY(EditAnywhere, Config, Category="Logging", Meta=(ClampMin=0))
+	float ExceptionReportInterval = 1.f;
+
+	/** How many times in a row a script function bound to Blueprint can throw before it's disabled until scripts are reloaded (0 never disables it) */
+	UPROPERTY(EditAnywhere, Config, Category="Logging", Meta=(ClampMin=0))
+	int32 MaxConsecutiveInvokeErrors = 0;
+
+	/** How many frames the consecutive errors have to happen within to count towards disabling a function */
+	UPROPERTY(EditAnywhere, Config, Category="Logging", Meta=(ClampMin=1))
+	int32 InvokeErrorFrameWindow = 60;
+
 	UPROPERTY(EditAnywhere, Config, Category="Inspector", Meta=(ConfigRestartRequired=true))
 	int32 Port = 19800;
 
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("Tsu"), STATGROUP_Tsu, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Eval Module"), STAT_TsuEvalModule, STATGROUP_Tsu, TSURUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Invoke"), STAT_TsuInvoke, STATGROUP_Tsu, TSURUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Invoke Delegate Event"), STAT_TsuInvokeDelegateEvent, STATGROUP_Tsu, TSURUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Call Method"), STAT_TsuCallMethod, STATGROUP_Tsu, TSURUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Call Native"), STAT_TsuCallNative, STATGROUP_Tsu, TSURUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Pop Arguments"), STAT_TsuPopArguments, STATGROUP_Tsu, TSURUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Write Parameters"), STAT_TsuWriteParameters, STATGROUP_Tsu, TSURUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Write Property"), STAT_TsuWriteProperty, STATGROUP_Tsu, TSURUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Read Property"), STAT_TsuReadProperty, STATGROUP_Tsu, TSURUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Add Template"), STAT_TsuAddTemplate, STATGROUP_Tsu, TSURUNTIME_API);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Alive Objects"), STAT_TsuAliveObjects, STATGROUP_Tsu, TSURUNTIME_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Alive Structs"), STAT_TsuAliveStructs, STATGROUP_Tsu, TSURUNTIME_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Alive Delegates"), STAT_TsuAliveDelegates, STATGROUP_Tsu, TSURUNTIME_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Alive Timers"), STAT_TsuAliveTimers, STATGROUP_Tsu, TSURUNTIME_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Marshalled Bytes"), STAT_TsuMarshalledBytes, STATGROUP_Tsu, TSURUNTIME_API);
@@ -2,6 +2,9 @@
 
 #include "CoreMinimal.h"
 
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
+
 using FTsuTypeSet = TSet<UField*>;
 
 class TSURUNTIME_API FTsuTypings
@@ -18,6 +21,20 @@ public:
 	static void WriteGlobalTypings();
 	static void WriteKeyTypings();
 	static void WriteAllTypings();
+
+	/**
+	 * Like WriteAllTypings, except that only the gathering and formatting of types happens right away,
+	 * on the game thread, while the typings themselves are saved in the background. Progress is shown
+	 * through a notification in the editor.
+	 */
+	static void WriteAllTypingsAsync();
+
+	/** Whether WriteAllTypingsAsync is still writing */
+	static bool IsWritingTypingsAsync();
+
+	/** Stops WriteAllTypingsAsync from saving any more typings, and waits for it to finish */
+	static void CancelTypingsAsync();
+
 	static void WriteTypings(UField* Type);
 	static void WriteDependencyTypings(class UTsuBlueprintGeneratedClass* Class);
 	static bool DoTypingsExist(UField* Type);
@@ -30,6 +47,7 @@ public:
 	static void WriteMethod(FString& Output, UFunction* Function);
 	static void WriteExtensionMethod(FString& Output, UFunction* Function);
 	static void WriteStaticExtensionMethod(FString& Output, UFunction* Function);
+	static void WriteConstant(FString& Output, UFunction* Function);
 	static void WriteParameters(FString& Output, UFunction* Function, bool bSkipFirst = false);
 	static void WriteReturns(FString& Output, UFunction* Function, bool bSkipFirst = false);
 	static void WriteProperty(FString& Output, UProperty* Property, bool bIsReadOnly);
@@ -46,9 +64,27 @@ public:
 	static const FString& TailorNameOfExtension(UFunction* Function);
 
 private:
+	struct FPendingTypings
+	{
+		TArray<TPair<UField*, FTsuTypeSet>> Types;
+
+		/** The name and contents of each pending type, which is all that saving them needs */
+		TArray<TPair<FString, FString>> Outputs;
+
+		TMap<FString, uint32> Manifest;
+		int32 NumFailed = 0;
+	};
+
+	static void GatherPendingTypings(FPendingTypings& OutPending);
+	static void FormatPendingTypings(FPendingTypings& Pending);
+	static void SavePendingTypings(FPendingTypings& Pending, FThreadSafeCounter* NumWritten, const FThreadSafeBool* bIsCancelled);
 	static FString& ResetPersistentOutputBuffer();
 	static bool IsReservedIdentifier(const FString& Word);
 	static bool WriteTypings(UField* Type, const FTsuTypeSet& References);
+	static FString& FormatTypings(UField* Type, const FTsuTypeSet& References);
+	static uint32 HashTypings(UField* Type, const FTsuTypeSet& References);
+	static TMap<FString, uint32> LoadTypingsManifest();
+	static void SaveTypingsManifest(const TMap<FString, uint32>& Manifest);
 	static FString& Deduplicate(FString& Name);
 	static FString& CamelCase(FString& Name);
 	static FString CamelCase(FString&& Name);
@@ -7,6 +7,7 @@ THIRD_PARTY_INCLUDES_START
 #include "v8.h"
 #include "v8-platform.h"
 #include "v8-inspector.h"
+#include "v8-profiler.h"
 #include "libplatform/libplatform.h"
 
 THIRD_PARTY_INCLUDES_END
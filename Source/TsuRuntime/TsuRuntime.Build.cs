@@ -1,3 +1,5 @@
+using System.Collections.Generic;
+using Tools.DotNETCommon;
 using UnrealBuildTool;
 
 public class TsuRuntime : ModuleRules
@@ -13,6 +15,9 @@ public class TsuRuntime : ModuleRules
 			{
 				"TsuUtilities",
                 "InputCore",
+                "Json",
+                "JsonUtilities",
+                "Projects",
 			});
 
 		PublicDependencyModuleNames.AddRange(
@@ -37,5 +42,47 @@ public class TsuRuntime : ModuleRules
 					"Settings"
 				});
 		}
+
+		AddStaticBindings(Target);
+	}
+
+	/**
+	 * Static bindings are generated by TsuGenerator for the modules listed under `[Tsu] StaticBindingModules` in
+	 * the engine config, and the generated glue includes their headers, so they have to be dependencies as well.
+	 * TsuGenerator is a separate UHT plugin that has to be installed into the engine, see Extras/TsuGenerator.
+	 */
+	private void AddStaticBindings(ReadOnlyTargetRules Target)
+	{
+		ConfigHierarchy EngineConfig = ConfigCache.ReadHierarchy(
+			ConfigHierarchyType.Engine,
+			DirectoryReference.FromFile(Target.ProjectFile),
+			Target.Platform);
+
+		List<string> StaticBindingModules;
+		if (!EngineConfig.GetArray("Tsu", "StaticBindingModules", out StaticBindingModules) || StaticBindingModules.Count == 0)
+		{
+			PrivateDefinitions.Add("WITH_TSU_STATIC_BINDINGS=0");
+		}
+		else if (!HasEnginePlugin("TsuGenerator"))
+		{
+			Log.TraceWarning("[Tsu] StaticBindingModules is set, but TsuGenerator isn't installed, falling back to reflection");
+			PrivateDefinitions.Add("WITH_TSU_STATIC_BINDINGS=0");
+		}
+		else
+		{
+			PrivateDependencyModuleNames.AddRange(StaticBindingModules);
+			PrivateDefinitions.Add("WITH_TSU_STATIC_BINDINGS=1");
+		}
+	}
+
+	private bool HasEnginePlugin(string Name)
+	{
+		foreach (PluginInfo Plugin in Plugins.ReadEnginePlugins(new DirectoryReference(EngineDirectory)))
+		{
+			if (Plugin.Name == Name)
+				return true;
+		}
+
+		return false;
 	}
 }
@@ -131,3 +131,11 @@ FString FTsuPaths::TypingPath(const TCHAR* TypeName)
 		TypeName,
 		TEXT("index.d.ts"));
 }
+
+FString FTsuPaths::TypeIndexPath()
+{
+	return FPaths::Combine(
+		FPaths::ProjectIntermediateDir(),
+		TEXT("Tsu"),
+		TEXT("TypeIndex.json"));
+}
@@ -16,4 +16,5 @@ struct TSUUTILITIES_API FTsuPaths
 	static FString BootstrapPath();
 	static FString TypingsDir();
 	static FString TypingPath(const TCHAR* TypeName);
+	static FString TypeIndexPath();
 };